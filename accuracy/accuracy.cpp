@@ -1,3 +1,4 @@
+#include <fpm/csv.hpp>
 #include <fpm/fixed.hpp>
 #include <fpm/math.hpp>
 #include <fixmath.h>
@@ -21,6 +22,11 @@ using std::acos;
 using std::atan;
 using std::atan2;
 using std::sqrt;
+using std::sinh;
+using std::cosh;
+using std::tanh;
+using std::erf;
+using std::erfc;
 
 static Fix16 sin(Fix16 x) { return x.sin(); }
 static Fix16 cos(Fix16 x) { return x.cos(); }
@@ -34,29 +40,42 @@ static Fix16 exp(Fix16 x) { return fix16_exp(x); }
 static Fix16 log(Fix16 x) { return fix16_log(x); }
 static Fix16 log2(Fix16 x) { return fix16_log2(x); }
 
-class csv_output
+static double rsqrt(double x) { return 1 / std::sqrt(x); }
+static double sigmoid(double x) { return 1 / (1 + std::exp(-x)); }
+static double normal_cdf(double x) { return std::erfc(-x / std::sqrt(2.0)) / 2; }
+
+// Inverts the normal CDF by bisection
+static double probit(double p)
 {
-public:
-    explicit csv_output(const std::string& filename)
-        : m_stream(filename)
+    double lo = -40, hi = 40;
+    for (int i = 0; i < 200; ++i)
     {
-        m_stream.setf(std::ios::fixed);
-        m_stream.precision(12);
-        m_stream << "x,real,Q24.8,Q20.12,Q16.16,Q8.24,fix16\n";
+        const double mid = (lo + hi) / 2;
+        (normal_cdf(mid) < p ? lo : hi) = mid;
     }
+    return (lo + hi) / 2;
+}
 
-    void write_row(double x, double y_real, double y_q24_8, double y_q20_12, double y_q16_16, double y_q8_24, double y_fix16)
+class csv_output
+{
+public:
+    explicit csv_output(const std::string& filename)
+        : m_stream(filename), m_writer(m_stream)
     {
-        m_stream << x << "," << y_real << "," << y_q24_8 << "," << y_q20_12 << "," << y_q16_16 << "," << y_q8_24 << "," << y_fix16 << "\n";
+        m_writer.precision(12);
+        m_writer.write_row("x", "real", "Q24.8", "Q20.12", "Q16.16", "Q8.24", "fix16");
     }
 
-    void write_row(double x, double y_real, double y_q24_8, double y_q20_12, double y_q16_16, double y_q8_24)
+    // Writes the argument, the real result, and the results of every type
+    template <typename... Values>
+    void write_row(const Values&... values)
     {
-        m_stream << x << "," << y_real << "," << y_q24_8 << "," << y_q20_12 << "," << y_q16_16 << "," << y_q8_24 << ",-\n";
+        m_writer.write_row(values...);
     }
 
 private:
     std::ofstream m_stream;
+    fpm::csv_writer m_writer;
 };
 
 template <typename Callable, typename... Args>
@@ -64,10 +83,10 @@ static void check_all(csv_output& output, double value, Callable&& callable, Arg
 {
     output.write_row(value,
         callable(std::forward<Args>(args)...),
-        static_cast<double>(callable(fixed_24_8(std::forward<Args>(args))...)),
-        static_cast<double>(callable(fixed_20_12(std::forward<Args>(args))...)),
-        static_cast<double>(callable(fixed_16_16(std::forward<Args>(args))...)),
-        static_cast<double>(callable(fixed_8_24(std::forward<Args>(args))...)),
+        callable(fixed_24_8(std::forward<Args>(args))...),
+        callable(fixed_20_12(std::forward<Args>(args))...),
+        callable(fixed_16_16(std::forward<Args>(args))...),
+        callable(fixed_8_24(std::forward<Args>(args))...),
         static_cast<double>(callable(Fix16(std::forward<Args>(args))...)));
 }
 
@@ -76,10 +95,11 @@ static void check_fpm(csv_output& output, double value, Callable&& callable, Arg
 {
     output.write_row(value,
         callable(std::forward<Args>(args)...),
-        static_cast<double>(callable(fixed_24_8(std::forward<Args>(args))...)),
-        static_cast<double>(callable(fixed_20_12(std::forward<Args>(args))...)),
-        static_cast<double>(callable(fixed_16_16(std::forward<Args>(args))...)),
-        static_cast<double>(callable(fixed_8_24(std::forward<Args>(args))...)));
+        callable(fixed_24_8(std::forward<Args>(args))...),
+        callable(fixed_20_12(std::forward<Args>(args))...),
+        callable(fixed_16_16(std::forward<Args>(args))...),
+        callable(fixed_8_24(std::forward<Args>(args))...),
+        "-");
 }
 
 int main()
@@ -127,6 +147,13 @@ int main()
         check_all(out_sqrt, val, [](auto x) { return sqrt(x); }, val);
     }
 
+    csv_output out_rsqrt("rsqrt.csv");
+    for (int i = 1; i < 1000; ++i)
+    {
+        const auto val = i / 10.0;
+        check_fpm(out_rsqrt, val, [](auto x) { return rsqrt(x); }, val);
+    }
+
     csv_output out_cbrt("cbrt.csv");
     for (int i = -1000; i < 1000; ++i)
     {
@@ -155,4 +182,35 @@ int main()
         check_all(out_log2, val, [](auto x) { return log2(x); }, val);
         check_fpm(out_log10, val, [](auto x) { return log10(x); }, val);
     }
+
+    csv_output out_sinh("sinh.csv");
+    csv_output out_cosh("cosh.csv");
+    csv_output out_tanh("tanh.csv");
+    csv_output out_sigmoid("sigmoid.csv");
+    for (int i = -40; i <= 40; i++)
+    {
+        const auto val = i / 10.0;
+        check_fpm(out_sinh, val, [](auto x) { return sinh(x); }, val);
+        check_fpm(out_cosh, val, [](auto x) { return cosh(x); }, val);
+        check_fpm(out_tanh, val, [](auto x) { return tanh(x); }, val);
+        check_fpm(out_sigmoid, val, [](auto x) { return sigmoid(x); }, val);
+    }
+
+    csv_output out_erf("erf.csv");
+    csv_output out_erfc("erfc.csv");
+    csv_output out_normal_cdf("normal_cdf.csv");
+    for (int i = -40; i <= 40; i++)
+    {
+        const auto val = i / 10.0;
+        check_fpm(out_erf, val, [](auto x) { return erf(x); }, val);
+        check_fpm(out_erfc, val, [](auto x) { return erfc(x); }, val);
+        check_fpm(out_normal_cdf, val, [](auto x) { return normal_cdf(x); }, val);
+    }
+
+    csv_output out_probit("probit.csv");
+    for (int i = 1; i < 100; i++)
+    {
+        const auto val = i / 100.0;
+        check_fpm(out_probit, val, [](auto x) { return probit(x); }, val);
+    }
 }
@@ -0,0 +1,244 @@
+#include <benchmark/benchmark.h>
+#include <fpm/charconv.hpp>
+#include <fpm/fixed.hpp>
+#include <fpm/format.hpp>
+#include <fpm/ios.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+// A typical price in a text feed
+static const char s_text[] = "1234.5678";
+static volatile int32_t s_raw = 80908635;
+
+static void parse_stream(benchmark::State& state)
+{
+    std::istringstream ss;
+    for (auto _ : state)
+    {
+        ss.clear();
+        ss.str(s_text);
+        fpm::fixed_16_16 value;
+        ss >> value;
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+// Like reading a large text file: many values from a single stream
+static void parse_stream_values(benchmark::State& state)
+{
+    std::ostringstream text;
+    for (std::uint32_t i = 0, seed = 12345; i < 1024; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        text << (static_cast<std::int32_t>(seed >> 8) - 4194304) / 1000.0 << '\n';
+    }
+    std::istringstream ss(text.str());
+    for (auto _ : state)
+    {
+        fpm::fixed_16_16 value;
+        if (!(ss >> value))
+        {
+            ss.clear();
+            ss.seekg(0);
+            ss >> value;
+        }
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+static void parse_from_chars(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        fpm::fixed_16_16 value;
+        benchmark::DoNotOptimize(fpm::from_chars(s_text, s_text + sizeof(s_text) - 1, value));
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+static void parse_strtod(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::strtod(s_text, nullptr));
+    }
+}
+
+static void format_stream(benchmark::State& state)
+{
+    std::ostringstream ss;
+    ss.precision(4);
+    ss.setf(std::ios::fixed);
+    for (auto _ : state)
+    {
+        ss.str(std::string());
+        ss << fpm::fixed_16_16::from_raw_value(s_raw);
+        benchmark::DoNotOptimize(ss);
+    }
+}
+
+static void format_formatter(benchmark::State& state)
+{
+    std::ostringstream ss;
+    const fpm::formatter formatter(std::ios::fixed, 4);
+    for (auto _ : state)
+    {
+        ss.str(std::string());
+        formatter.format(*ss.rdbuf(), fpm::fixed_16_16::from_raw_value(s_raw));
+        benchmark::DoNotOptimize(ss);
+    }
+}
+
+static void format_formatter_buffer(benchmark::State& state)
+{
+    char buffer[32];
+    const fpm::formatter formatter(std::ios::fixed, 4);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(formatter.format(buffer, sizeof(buffer), fpm::fixed_16_16::from_raw_value(s_raw)));
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+
+static void format_to_chars(benchmark::State& state)
+{
+    char buffer[32];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fpm::to_chars(buffer, buffer + sizeof(buffer), fpm::fixed_16_16::from_raw_value(s_raw), fpm::chars_format::fixed, 4));
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+
+static void format_snprintf(benchmark::State& state)
+{
+    char buffer[32];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::snprintf(buffer, sizeof(buffer), "%.4f", s_raw / 65536.0));
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+
+#if defined(__cpp_lib_format)
+static void format_std_format(benchmark::State& state)
+{
+    char buffer[32];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::format_to(buffer, "{:.4f}", fpm::fixed_16_16::from_raw_value(s_raw)));
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+
+static void format_std_format_int(benchmark::State& state)
+{
+    char buffer[32];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::format_to(buffer, "{}", static_cast<std::int32_t>(s_raw)));
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+#endif
+
+// Telemetry-like values: a random walk with a few fraction bits of noise
+static std::vector<fpm::fixed_16_16> make_values()
+{
+    std::vector<fpm::fixed_16_16> values;
+    std::int32_t raw = 1 << 20;
+    for (std::uint32_t i = 0, seed = 12345; i < 1024; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        raw += static_cast<std::int32_t>(seed >> 16) - 32768;
+        values.push_back(fpm::fixed_16_16::from_raw_value(raw));
+    }
+    return values;
+}
+
+template <typename Format>
+static void format_values(benchmark::State& state, Format format)
+{
+    const auto values = make_values();
+    char buffer[64];
+    std::size_t i = 0, bytes = 0;
+    for (auto _ : state)
+    {
+        char* end = format(buffer, buffer + sizeof(buffer), values[i++ % values.size()]);
+        benchmark::DoNotOptimize(buffer);
+        bytes += static_cast<std::size_t>(end - buffer);
+    }
+    state.counters["bytes"] = static_cast<double>(bytes) / static_cast<double>(state.iterations());
+}
+
+static void format_shortest(benchmark::State& state)
+{
+    format_values(state, [](char* first, char* last, fpm::fixed_16_16 value) {
+        return fpm::to_chars(first, last, value).ptr;
+    });
+}
+
+static void format_max_digits(benchmark::State& state)
+{
+    // The stream operator's behavior with max_digits10 as precision
+    format_values(state, [](char* first, char* last, fpm::fixed_16_16 value) {
+        return fpm::to_chars(first, last, value, fpm::chars_format::general, std::numeric_limits<fpm::fixed_16_16>::max_digits10).ptr;
+    });
+}
+
+// Formats many digits with a formatter, so the digit generation dominates
+static void format_digits(benchmark::State& state, std::ios::fmtflags flags)
+{
+    const fpm::formatter formatter(flags, 8);
+    format_values(state, [&formatter](char* first, char* last, fpm::fixed_16_16 value) {
+        return first + formatter.format(first, static_cast<std::size_t>(last - first), value);
+    });
+}
+
+static void format_digits_fixed(benchmark::State& state)
+{
+    format_digits(state, std::ios::fixed);
+}
+
+static void format_digits_scientific(benchmark::State& state)
+{
+    format_digits(state, std::ios::scientific);
+}
+
+#if defined(__cpp_lib_to_chars)
+static void format_shortest_double(benchmark::State& state)
+{
+    format_values(state, [](char* first, char* last, fpm::fixed_16_16 value) {
+        return std::to_chars(first, last, static_cast<double>(value)).ptr;
+    });
+}
+#endif
+
+BENCHMARK(parse_stream);
+BENCHMARK(parse_stream_values);
+BENCHMARK(parse_from_chars);
+BENCHMARK(parse_strtod);
+BENCHMARK(format_stream);
+BENCHMARK(format_formatter);
+BENCHMARK(format_formatter_buffer);
+BENCHMARK(format_to_chars);
+BENCHMARK(format_snprintf);
+#if defined(__cpp_lib_format)
+BENCHMARK(format_std_format);
+BENCHMARK(format_std_format_int);
+#endif
+BENCHMARK(format_shortest);
+BENCHMARK(format_max_digits);
+BENCHMARK(format_digits_fixed);
+BENCHMARK(format_digits_scientific);
+#if defined(__cpp_lib_to_chars)
+BENCHMARK(format_shortest_double);
+#endif
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+#include <fpm/compress.hpp>
+#include <fpm/fixed.hpp>
+#include <cstdint>
+#include <vector>
+
+// Sensor readings as Q16.16: a slowly changing signal with a few bits of noise
+static const std::vector<fpm::fixed_16_16>& sensor_values()
+{
+    static const auto values = [] {
+        std::vector<fpm::fixed_16_16> values;
+        std::int32_t signal = 20 << 16;
+        for (std::uint32_t i = 0, seed = 12345; i < 1000000; ++i)
+        {
+            seed = seed * 1103515245 + 12345;
+            signal += static_cast<std::int32_t>(seed >> 28) - 8;
+            values.push_back(fpm::fixed_16_16::from_raw_value(signal + static_cast<std::int32_t>((seed >> 8) & 0xff)));
+        }
+        return values;
+    }();
+    return values;
+}
+
+static void compress(benchmark::State& state)
+{
+    const auto& values = sensor_values();
+    std::vector<unsigned char> data;
+    for (auto _ : state)
+    {
+        data.clear();
+        fpm::compress(values.data(), values.size(), data);
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * values.size() * sizeof(values[0])));
+    state.counters["ratio"] = static_cast<double>(values.size() * sizeof(values[0])) / data.size();
+}
+
+static void decompress(benchmark::State& state)
+{
+    const auto& values = sensor_values();
+    std::vector<unsigned char> data;
+    fpm::compress(values.data(), values.size(), data);
+    std::vector<fpm::fixed_16_16> result;
+    for (auto _ : state)
+    {
+        result.clear();
+        fpm::decompress(data, result);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * values.size() * sizeof(values[0])));
+}
+
+BENCHMARK(compress)->Unit(benchmark::kMillisecond);
+BENCHMARK(decompress)->Unit(benchmark::kMillisecond);
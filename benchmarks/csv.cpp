@@ -0,0 +1,157 @@
+#include <benchmark/benchmark.h>
+#include <fpm/binary.hpp>
+#include <fpm/csv.hpp>
+#include <fpm/fixed.hpp>
+#include <fpm/ios.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+// Prices and sensor readings: a few columns of values with a few decimals
+static const std::string& csv_text()
+{
+    static const std::string text = [] {
+        std::ostringstream ss;
+        ss << "time,price,volume,temperature\n";
+        for (std::uint32_t i = 0, seed = 12345; i < 200000; ++i)
+        {
+            seed = seed * 1103515245 + 12345;
+            ss << i << ',' << (seed >> 12) / 1000.0 << ',' << (seed & 0xfff) << ',' << (static_cast<int>(seed % 8000) - 4000) / 100.0 << '\n';
+        }
+        return ss.str();
+    }();
+    return text;
+}
+
+static void csv_stream(benchmark::State& state)
+{
+    const auto& text = csv_text();
+    for (auto _ : state)
+    {
+        std::vector<std::vector<fpm::fixed_16_16>> columns(4);
+        std::istringstream ss(text);
+        std::string line;
+        std::getline(ss, line);
+        for (fpm::fixed_16_16 value; ss >> value; )
+        {
+            columns[0].push_back(value);
+            for (int column = 1; column < 4 && ss.ignore(1) >> value; ++column)
+            {
+                columns[column].push_back(value);
+            }
+        }
+        benchmark::DoNotOptimize(columns);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * text.size()));
+}
+
+static void csv_read(benchmark::State& state)
+{
+    const auto& text = csv_text();
+    fpm::csv_options options;
+    options.threads = static_cast<unsigned int>(state.range(0));
+    for (auto _ : state)
+    {
+        fpm::csv_table<fpm::fixed_16_16> table;
+        fpm::read_csv(text.data(), text.data() + text.size(), table, options);
+        benchmark::DoNotOptimize(table);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * text.size()));
+}
+
+static const std::vector<std::vector<fpm::fixed_16_16>>& csv_columns()
+{
+    static const auto columns = [] {
+        fpm::csv_table<fpm::fixed_16_16> table;
+        fpm::read_csv(csv_text().data(), csv_text().data() + csv_text().size(), table);
+        return table.columns;
+    }();
+    return columns;
+}
+
+static void csv_write_stream(benchmark::State& state)
+{
+    const auto& columns = csv_columns();
+    std::size_t bytes = 0;
+    for (auto _ : state)
+    {
+        std::ostringstream ss;
+        ss.precision(3);
+        ss.setf(std::ios::fixed);
+        for (std::size_t row = 0; row < columns[0].size(); ++row)
+        {
+            ss << columns[0][row] << ',' << columns[1][row] << ',' << columns[2][row] << ',' << columns[3][row] << '\n';
+        }
+        bytes += ss.str().size();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+}
+
+static void csv_write(benchmark::State& state)
+{
+    const auto& columns = csv_columns();
+    std::size_t bytes = 0;
+    for (auto _ : state)
+    {
+        std::ostringstream ss;
+        {
+            fpm::csv_writer writer(ss);
+            writer.precision(3);
+            writer.write_columns(columns, static_cast<unsigned int>(state.range(0)));
+        }
+        bytes += ss.str().size();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+}
+
+// The values of the CSV data, as a binary file
+static const char* binary_file()
+{
+    static const char* const path = [] {
+        std::vector<fpm::fixed_16_16> values;
+        for (const auto& column : csv_columns())
+        {
+            values.insert(values.end(), column.begin(), column.end());
+        }
+        const char* path = "fpm_benchmark.bin";
+        fpm::binary::write(path, values);
+        std::atexit([] { std::remove("fpm_benchmark.bin"); });
+        return path;
+    }();
+    return path;
+}
+
+static void binary_read(benchmark::State& state)
+{
+    const char* const path = binary_file();
+    for (auto _ : state)
+    {
+        std::vector<fpm::fixed_16_16> values;
+        fpm::binary::read(path, values);
+        benchmark::DoNotOptimize(values);
+    }
+}
+
+static void binary_view(benchmark::State& state)
+{
+    const char* const path = binary_file();
+    for (auto _ : state)
+    {
+        fpm::binary::view<fpm::fixed_16_16> view;
+        view.open(path);
+        auto sum = fpm::fixed_16_16(0);
+        for (auto value : view)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(csv_stream)->Unit(benchmark::kMillisecond);
+BENCHMARK(csv_read)->Arg(1)->Arg(4)->Arg(0)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(csv_write_stream)->Unit(benchmark::kMillisecond);
+BENCHMARK(csv_write)->Arg(1)->Arg(4)->Arg(0)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(binary_read)->Unit(benchmark::kMillisecond);
+BENCHMARK(binary_view)->Unit(benchmark::kMillisecond);
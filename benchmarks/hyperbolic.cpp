@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+#include <fpm/fixed.hpp>
+#include <fpm/math.hpp>
+#include <vector>
+
+#define BENCHMARK_TEMPLATE1_CAPTURE(func, test_case_name, a, ...)   \
+  BENCHMARK_PRIVATE_DECLARE(func) =                                 \
+      (::benchmark::internal::RegisterBenchmarkInternal(            \
+          new ::benchmark::internal::FunctionBenchmark(             \
+              #func "<" #a ">/" #test_case_name,					\
+              [](::benchmark::State& st) { func<a>(st, __VA_ARGS__); })))
+
+// Constant for our hyperbolic function argument.
+// Stored as volatile to force the compiler to read them and
+// not optimize the entire expression into a constant.
+static volatile int16_t s_x = -174;
+
+template <typename TValue>
+static void hyperbolic(benchmark::State& state, TValue (*func)(TValue))
+{
+    for (auto _ : state)
+    {
+        TValue x{ static_cast<TValue>(s_x / 256.0) };
+        benchmark::DoNotOptimize(func(x));
+    }
+}
+
+// Applies a function to a buffer of values in [-8,8]
+template <typename TValue>
+static void batch(benchmark::State& state, void (*func)(const TValue*, const TValue*, TValue*))
+{
+    std::vector<TValue> values(256);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<TValue>(i / 16.0 - 8);
+    }
+    std::vector<TValue> results(values.size());
+    for (auto _ : state)
+    {
+        func(values.data(), values.data() + values.size(), results.data());
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+// Implementations in terms of exp, as a baseline
+template <typename TValue>
+static TValue naive_tanh(TValue x)
+{
+    using std::exp;
+    const TValue e = exp(x + x);
+    return (e - TValue{1}) / (e + TValue{1});
+}
+
+template <typename TValue>
+static TValue naive_sigmoid(TValue x)
+{
+    using std::exp;
+    return TValue{1} / (TValue{1} + exp(-x));
+}
+
+template <typename TValue>
+static TValue float_sigmoid(TValue x)
+{
+    return 1 / (1 + std::exp(-x));
+}
+
+template <typename TValue>
+static TValue float_softplus(TValue x)
+{
+    return std::log1p(std::exp(x));
+}
+
+template <typename TValue>
+static TValue float_gelu(TValue x)
+{
+    return x / 2 * (1 + std::tanh(static_cast<TValue>(0.7978845608028654) * (x + static_cast<TValue>(0.044715) * x * x * x)));
+}
+
+template <typename TValue, TValue (*func)(TValue)>
+static void float_batch(const TValue* first, const TValue* last, TValue* d_first)
+{
+    for (; first != last; ++first, ++d_first)
+    {
+        *d_first = func(*first);
+    }
+}
+
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, sinh, float, &std::sinh);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, sinh, double, &std::sinh);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, sinh, fpm::fixed_16_16, &fpm::sinh);
+
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, cosh, float, &std::cosh);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, cosh, double, &std::cosh);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, cosh, fpm::fixed_16_16, &fpm::cosh);
+
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, tanh, float, &std::tanh);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, tanh, double, &std::tanh);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, tanh, fpm::fixed_16_16, &fpm::tanh);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, tanh_naive, fpm::fixed_16_16, &naive_tanh<fpm::fixed_16_16>);
+
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, sigmoid, float, &float_sigmoid<float>);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, sigmoid, double, &float_sigmoid<double>);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, sigmoid, fpm::fixed_16_16, &fpm::sigmoid);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, sigmoid_naive, fpm::fixed_16_16, &naive_sigmoid<fpm::fixed_16_16>);
+
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, softplus, float, &float_softplus<float>);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, softplus, double, &float_softplus<double>);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, softplus, fpm::fixed_16_16, &fpm::softplus);
+
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, gelu, float, &float_gelu<float>);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, gelu, double, &float_gelu<double>);
+BENCHMARK_TEMPLATE1_CAPTURE(hyperbolic, gelu, fpm::fixed_16_16, &fpm::gelu);
+
+BENCHMARK_TEMPLATE1_CAPTURE(batch, tanh, float, &float_batch<float, &std::tanh>);
+BENCHMARK_TEMPLATE1_CAPTURE(batch, tanh, fpm::fixed_16_16, &fpm::tanh);
+BENCHMARK_TEMPLATE1_CAPTURE(batch, sigmoid, float, &float_batch<float, &float_sigmoid<float>>);
+BENCHMARK_TEMPLATE1_CAPTURE(batch, sigmoid, fpm::fixed_16_16, &fpm::sigmoid);
+BENCHMARK_TEMPLATE1_CAPTURE(batch, gelu, float, &float_batch<float, &float_gelu<float>>);
+BENCHMARK_TEMPLATE1_CAPTURE(batch, gelu, fpm::fixed_16_16, &fpm::gelu);
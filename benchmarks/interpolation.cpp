@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+#include <fpm/fixed.hpp>
+#include <fpm/math.hpp>
+#include <algorithm>
+
+#define BENCHMARK_TEMPLATE1_CAPTURE(func, test_case_name, a, ...)   \
+  BENCHMARK_PRIVATE_DECLARE(func) =                                 \
+      (::benchmark::internal::RegisterBenchmarkInternal(            \
+          new ::benchmark::internal::FunctionBenchmark(             \
+              #func "<" #a ">/" #test_case_name,					\
+              [](::benchmark::State& st) { func<a>(st, __VA_ARGS__); })))
+
+// Constants for our function arguments.
+// Stored as volatile to force the compiler to read them and
+// not optimize the entire expression into a constant.
+static volatile int16_t s_a = -174;
+static volatile int16_t s_b = 2281;
+static volatile int16_t s_t = 87;
+
+template <typename TValue>
+static void interpolation(benchmark::State& state, TValue (*func)(TValue, TValue, TValue))
+{
+    for (auto _ : state)
+    {
+        TValue a{ static_cast<TValue>(s_a / 256.0) };
+        TValue b{ static_cast<TValue>(s_b / 256.0) };
+        TValue t{ static_cast<TValue>(s_t / 256.0) };
+        benchmark::DoNotOptimize(func(a, b, t));
+    }
+}
+
+template <typename TValue>
+static TValue naive_lerp(TValue a, TValue b, TValue t)
+{
+    return a + (b - a) * t;
+}
+
+template <typename TValue>
+static TValue naive_smoothstep(TValue edge0, TValue edge1, TValue x)
+{
+    const TValue t = std::min(std::max((x - edge0) / (edge1 - edge0), TValue(0)), TValue(1));
+    return t * t * (TValue(3) - TValue(2) * t);
+}
+
+template <typename TValue>
+static TValue catmull_rom_proxy(TValue a, TValue b, TValue t)
+{
+    return catmull_rom(a - b, a, b, b + b, t);
+}
+
+// The Taylor series of e^x up to degree 7, with the coefficients in Q.30
+template <typename TValue>
+static TValue naive_poly(TValue a, TValue, TValue)
+{
+    TValue result(213044 / 1073741824.0);
+    result = result * a + TValue(1491308 / 1073741824.0);
+    result = result * a + TValue(8947849 / 1073741824.0);
+    result = result * a + TValue(44739243 / 1073741824.0);
+    result = result * a + TValue(178956971 / 1073741824.0);
+    result = result * a + TValue(0.5);
+    result = result * a + TValue(1);
+    return result * a + TValue(1);
+}
+
+template <typename TValue>
+using exp_poly = fpm::poly<TValue, 30, 1073741824, 1073741824, 536870912, 178956971, 44739243, 8947849, 1491308, 213044>;
+
+template <typename TValue>
+static TValue poly_horner(TValue a, TValue, TValue)
+{
+    return exp_poly<TValue>::horner(a);
+}
+
+template <typename TValue>
+static TValue poly_estrin(TValue a, TValue, TValue)
+{
+    return exp_poly<TValue>::estrin(a);
+}
+
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, lerp, float, &naive_lerp<float>);
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, lerp, double, &naive_lerp<double>);
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, lerp, fpm::fixed_16_16, &fpm::lerp);
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, lerp_naive, fpm::fixed_16_16, &naive_lerp<fpm::fixed_16_16>);
+
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, inverse_lerp, fpm::fixed_16_16, &fpm::inverse_lerp);
+
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, smoothstep, float, &naive_smoothstep<float>);
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, smoothstep, double, &naive_smoothstep<double>);
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, smoothstep, fpm::fixed_16_16, &fpm::smoothstep);
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, smoothstep_naive, fpm::fixed_16_16, &naive_smoothstep<fpm::fixed_16_16>);
+
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, catmull_rom, fpm::fixed_16_16, &catmull_rom_proxy<fpm::fixed_16_16>);
+
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, poly, double, &naive_poly<double>);
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, poly_naive, fpm::fixed_16_16, &naive_poly<fpm::fixed_16_16>);
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, poly_horner, fpm::fixed_16_16, &poly_horner<fpm::fixed_16_16>);
+BENCHMARK_TEMPLATE1_CAPTURE(interpolation, poly_estrin, fpm::fixed_16_16, &poly_estrin<fpm::fixed_16_16>);
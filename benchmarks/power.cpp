@@ -3,6 +3,7 @@
 #include <fpm/math.hpp>
 #include <cnl/fixed_point.h>
 #include <fixmath.h>
+#include <vector>
 
 #define BENCHMARK_TEMPLATE1_CAPTURE(func, test_case_name, a, ...)   \
   BENCHMARK_PRIVATE_DECLARE(func) =                                 \
@@ -17,6 +18,19 @@ static Fix16 fix16_func(Fix16 f)
     return (*func)(f);
 }
 
+template <typename TValue>
+static TValue native_rsqrt(TValue x)
+{
+    return 1 / std::sqrt(x);
+}
+
+template <typename TValue>
+static TValue naive_hypot(TValue x, TValue y)
+{
+    using std::sqrt;
+    return sqrt(x * x + y * y);
+}
+
 // Constants for our power function arguments.
 // Stored as volatile to force the compiler to read them and
 // not optimize the entire expression into a constant.
@@ -54,6 +68,88 @@ static void power2(benchmark::State& state, TValue (*func)(TValue, TValue))
     }
 }
 
+// Benchmarks a function for a single argument across input magnitudes.
+// The argument is 1.33 * 2^(N - 16), where N is the benchmark's range argument.
+template <typename TValue>
+static void magnitude(benchmark::State& state, TValue (*func)(TValue))
+{
+    TValue x{ static_cast<TValue>(std::ldexp(s_x / 2048.0, static_cast<int>(state.range(0)) - 16)) };
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(x);
+        benchmark::DoNotOptimize(func(x));
+    }
+}
+
+// Benchmarks a function for a single argument across a range of positive and negative values.
+// The argument is 0.67 * (N - 8), where N is the benchmark's range argument.
+template <typename TValue>
+static void signed_range(benchmark::State& state, TValue (*func)(TValue))
+{
+    TValue x{ static_cast<TValue>(s_x / 4096.0 * static_cast<int>(state.range(0) - 8)) };
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(x);
+        benchmark::DoNotOptimize(func(x));
+    }
+}
+
+template <typename TValue>
+static void vector3(benchmark::State& state, void (*func)(TValue*, TValue*, TValue*))
+{
+    for (auto _ : state)
+    {
+        TValue x{ static_cast<TValue>(s_x / 256.0) };
+        TValue y{ static_cast<TValue>(s_y / 256.0) };
+        TValue z{ static_cast<TValue>(-s_y / 256.0) };
+        func(&x, &y, &z);
+        benchmark::DoNotOptimize(x);
+        benchmark::DoNotOptimize(y);
+        benchmark::DoNotOptimize(z);
+    }
+}
+
+// Normalizes a vector by dividing its components by its length
+template <typename TValue>
+static void naive_normalize3(TValue* x, TValue* y, TValue* z)
+{
+    using std::sqrt;
+    const TValue length = sqrt(*x * *x + *y * *y + *z * *z);
+    *x = *x / length;
+    *y = *y / length;
+    *z = *z / length;
+}
+
+// Applies a gamma curve to a buffer of values in [0,1]
+template <typename TValue>
+static void gamma(benchmark::State& state, void (*func)(const TValue*, const TValue*, TValue, TValue*))
+{
+    std::vector<TValue> values(256);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<TValue>(i / 255.0);
+    }
+    std::vector<TValue> results(values.size());
+    const TValue exponent{ static_cast<TValue>(s_x / 6014.8) };
+    for (auto _ : state)
+    {
+        func(values.data(), values.data() + values.size(), exponent, results.data());
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+// Raises every value to the exponent with the scalar pow function
+template <typename TValue>
+static void naive_pow(const TValue* first, const TValue* last, TValue exp, TValue* d_first)
+{
+    using std::pow;
+    for (; first != last; ++first, ++d_first)
+    {
+        *d_first = pow(*first, exp);
+    }
+}
+
 using CnlFixed16 = cnl::fixed_point<std::int32_t, -16>;
 
 BENCHMARK_TEMPLATE1_CAPTURE(power1, sqrt, float, &std::sqrt);
@@ -62,13 +158,25 @@ BENCHMARK_TEMPLATE1_CAPTURE(power1, sqrt, fpm::fixed_16_16, &fpm::sqrt);
 BENCHMARK_TEMPLATE1_CAPTURE(power1, sqrt, Fix16, fix16_func<&fix16_sqrt>);
 BENCHMARK_TEMPLATE1_CAPTURE(power1, sqrt, CnlFixed16, &cnl::sqrt);
 
+BENCHMARK_TEMPLATE1_CAPTURE(magnitude, sqrt, float, &std::sqrt)->DenseRange(0, 30, 2);
+BENCHMARK_TEMPLATE1_CAPTURE(magnitude, sqrt, fpm::fixed_16_16, &fpm::sqrt)->DenseRange(0, 30, 2);
+BENCHMARK_TEMPLATE1_CAPTURE(magnitude, sqrt, Fix16, fix16_func<&fix16_sqrt>)->DenseRange(0, 30, 2);
+
+BENCHMARK_TEMPLATE1_CAPTURE(power1, rsqrt, float, &native_rsqrt<float>);
+BENCHMARK_TEMPLATE1_CAPTURE(power1, rsqrt, double, &native_rsqrt<double>);
+BENCHMARK_TEMPLATE1_CAPTURE(power1, rsqrt, fpm::fixed_16_16, &fpm::rsqrt);
+
 BENCHMARK_TEMPLATE1_CAPTURE(power1, cbrt, float, &std::cbrt);
 BENCHMARK_TEMPLATE1_CAPTURE(power1, cbrt, double, &std::cbrt);
 BENCHMARK_TEMPLATE1_CAPTURE(power1, cbrt, fpm::fixed_16_16, &fpm::cbrt);
 
+BENCHMARK_TEMPLATE1_CAPTURE(magnitude, cbrt, float, &std::cbrt)->DenseRange(0, 30, 2);
+BENCHMARK_TEMPLATE1_CAPTURE(magnitude, cbrt, fpm::fixed_16_16, &fpm::cbrt)->DenseRange(0, 30, 2);
+
 BENCHMARK_TEMPLATE1_CAPTURE(power1, log, float, &std::log);
 BENCHMARK_TEMPLATE1_CAPTURE(power1, log, double, &std::log);
 BENCHMARK_TEMPLATE1_CAPTURE(power1, log, fpm::fixed_16_16, &fpm::log);
+BENCHMARK_TEMPLATE1_CAPTURE(power1, log, Fix16, fix16_func<&fix16_log>);
 
 BENCHMARK_TEMPLATE1_CAPTURE(power1, log2, float, &std::log2);
 BENCHMARK_TEMPLATE1_CAPTURE(power1, log2, double, &std::log2);
@@ -85,6 +193,10 @@ BENCHMARK_TEMPLATE1_CAPTURE(power1, exp, fpm::fixed_16_16, &fpm::exp);
 BENCHMARK_TEMPLATE1_CAPTURE(power1, exp, Fix16, fix16_func<&fix16_exp>);
 BENCHMARK_TEMPLATE1_CAPTURE(power1, exp, CnlFixed16, &cnl::exp);
 
+BENCHMARK_TEMPLATE1_CAPTURE(signed_range, exp, float, &std::exp)->DenseRange(0, 16, 2);
+BENCHMARK_TEMPLATE1_CAPTURE(signed_range, exp, fpm::fixed_16_16, &fpm::exp)->DenseRange(0, 16, 2);
+BENCHMARK_TEMPLATE1_CAPTURE(signed_range, exp, Fix16, fix16_func<&fix16_exp>)->DenseRange(0, 16, 2);
+
 BENCHMARK_TEMPLATE1_CAPTURE(power1, exp2, float, &std::exp2);
 BENCHMARK_TEMPLATE1_CAPTURE(power1, exp2, double, &std::exp2);
 BENCHMARK_TEMPLATE1_CAPTURE(power1, exp2, fpm::fixed_16_16, &fpm::exp2);
@@ -92,3 +204,19 @@ BENCHMARK_TEMPLATE1_CAPTURE(power1, exp2, fpm::fixed_16_16, &fpm::exp2);
 BENCHMARK_TEMPLATE1_CAPTURE(power2, pow, float, &std::pow);
 BENCHMARK_TEMPLATE1_CAPTURE(power2, pow, double, &std::pow);
 BENCHMARK_TEMPLATE1_CAPTURE(power2, pow, fpm::fixed_16_16, &fpm::pow);
+
+BENCHMARK_TEMPLATE1_CAPTURE(power2, hypot, float, &std::hypot);
+BENCHMARK_TEMPLATE1_CAPTURE(power2, hypot, double, &std::hypot);
+BENCHMARK_TEMPLATE1_CAPTURE(power2, hypot, fpm::fixed_16_16, &fpm::hypot);
+BENCHMARK_TEMPLATE1_CAPTURE(power2, hypot_naive, fpm::fixed_16_16, &naive_hypot<fpm::fixed_16_16>);
+BENCHMARK_TEMPLATE1_CAPTURE(power2, hypot_fast, fpm::fixed_16_16, &fpm::fast::hypot);
+BENCHMARK_TEMPLATE1_CAPTURE(power2, hypot_octagonal, fpm::fixed_16_16, &fpm::fast::hypot_octagonal);
+
+BENCHMARK_TEMPLATE1_CAPTURE(gamma, pow, float, &naive_pow<float>);
+BENCHMARK_TEMPLATE1_CAPTURE(gamma, pow, fpm::fixed_16_16, &fpm::pow);
+BENCHMARK_TEMPLATE1_CAPTURE(gamma, pow_naive, fpm::fixed_16_16, &naive_pow<fpm::fixed_16_16>);
+
+BENCHMARK_TEMPLATE1_CAPTURE(vector3, normalize, float, &naive_normalize3<float>);
+BENCHMARK_TEMPLATE1_CAPTURE(vector3, normalize, double, &naive_normalize3<double>);
+BENCHMARK_TEMPLATE1_CAPTURE(vector3, normalize, fpm::fixed_16_16, &fpm::normalize3);
+BENCHMARK_TEMPLATE1_CAPTURE(vector3, normalize_naive, fpm::fixed_16_16, &naive_normalize3<fpm::fixed_16_16>);
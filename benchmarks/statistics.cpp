@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+#include <fpm/fixed.hpp>
+#include <fpm/math.hpp>
+#include <cmath>
+
+#define BENCHMARK_TEMPLATE1_CAPTURE(func, test_case_name, a, ...)   \
+  BENCHMARK_PRIVATE_DECLARE(func) =                                 \
+      (::benchmark::internal::RegisterBenchmarkInternal(            \
+          new ::benchmark::internal::FunctionBenchmark(             \
+              #func "<" #a ">/" #test_case_name,					\
+              [](::benchmark::State& st) { func<a>(st, __VA_ARGS__); })))
+
+// Constants for our function arguments.
+// Stored as volatile to force the compiler to read them and
+// not optimize the entire expression into a constant.
+static volatile int16_t s_x = -174;
+static volatile int16_t s_p = 43;
+
+template <typename TValue>
+static void statistics(benchmark::State& state, TValue (*func)(TValue))
+{
+    for (auto _ : state)
+    {
+        TValue x{ static_cast<TValue>(s_x / 256.0) };
+        benchmark::DoNotOptimize(func(x));
+    }
+}
+
+// Benchmarks a function of a probability in (0, 1)
+template <typename TValue>
+static void probability(benchmark::State& state, TValue (*func)(TValue))
+{
+    for (auto _ : state)
+    {
+        TValue p{ static_cast<TValue>(s_p / 256.0) };
+        benchmark::DoNotOptimize(func(p));
+    }
+}
+
+template <typename TValue>
+static TValue float_normal_cdf(TValue x)
+{
+    return std::erfc(-x / std::sqrt(TValue{2})) / 2;
+}
+
+// Acklam's approximation of the inverse normal CDF, with one step of Halley's method
+template <typename TValue>
+static TValue float_probit(TValue p)
+{
+    static const TValue a[] = { -3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02, 1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00 };
+    static const TValue b[] = { -5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02, 6.680131188771972e+01, -1.328068155288572e+01 };
+    static const TValue c[] = { -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00, -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00 };
+    static const TValue d[] = { 7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00, 3.754408661907416e+00 };
+
+    const TValue lo = std::min(p, 1 - p);
+    TValue x;
+    if (lo >= static_cast<TValue>(0.02425))
+    {
+        const TValue q = p - static_cast<TValue>(0.5), r = q * q;
+        x = (((((a[0]*r + a[1])*r + a[2])*r + a[3])*r + a[4])*r + a[5])*q / (((((b[0]*r + b[1])*r + b[2])*r + b[3])*r + b[4])*r + 1);
+    }
+    else
+    {
+        const TValue q = std::sqrt(-2 * std::log(lo));
+        x = (((((c[0]*q + c[1])*q + c[2])*q + c[3])*q + c[4])*q + c[5]) / ((((d[0]*q + d[1])*q + d[2])*q + d[3])*q + 1);
+        x = (p < lo + lo) ? x : -x;
+    }
+
+    const TValue e = float_normal_cdf(x) - p;
+    const TValue u = e * static_cast<TValue>(2.5066282746310002) * std::exp(x * x / 2);
+    return x - u / (1 + x * u / 2);
+}
+
+// Evaluates a function through double, as a baseline for the fixed-point implementations
+template <typename TValue, double (*func)(double)>
+static TValue via_double(TValue x)
+{
+    return static_cast<TValue>(func(static_cast<double>(x)));
+}
+
+BENCHMARK_TEMPLATE1_CAPTURE(statistics, erf, float, &std::erf);
+BENCHMARK_TEMPLATE1_CAPTURE(statistics, erf, double, &std::erf);
+BENCHMARK_TEMPLATE1_CAPTURE(statistics, erf, fpm::fixed_16_16, &fpm::erf);
+BENCHMARK_TEMPLATE1_CAPTURE(statistics, erf_double, fpm::fixed_16_16, &via_double<fpm::fixed_16_16, &std::erf>);
+
+BENCHMARK_TEMPLATE1_CAPTURE(statistics, erfc, float, &std::erfc);
+BENCHMARK_TEMPLATE1_CAPTURE(statistics, erfc, double, &std::erfc);
+BENCHMARK_TEMPLATE1_CAPTURE(statistics, erfc, fpm::fixed_16_16, &fpm::erfc);
+
+BENCHMARK_TEMPLATE1_CAPTURE(statistics, normal_cdf, float, &float_normal_cdf<float>);
+BENCHMARK_TEMPLATE1_CAPTURE(statistics, normal_cdf, double, &float_normal_cdf<double>);
+BENCHMARK_TEMPLATE1_CAPTURE(statistics, normal_cdf, fpm::fixed_16_16, &fpm::normal_cdf);
+BENCHMARK_TEMPLATE1_CAPTURE(statistics, normal_cdf_double, fpm::fixed_16_16, &via_double<fpm::fixed_16_16, &float_normal_cdf<double>>);
+
+BENCHMARK_TEMPLATE1_CAPTURE(probability, probit, float, &float_probit<float>);
+BENCHMARK_TEMPLATE1_CAPTURE(probability, probit, double, &float_probit<double>);
+BENCHMARK_TEMPLATE1_CAPTURE(probability, probit, fpm::fixed_16_16, &fpm::probit);
+BENCHMARK_TEMPLATE1_CAPTURE(probability, probit_double, fpm::fixed_16_16, &via_double<fpm::fixed_16_16, &float_probit<double>>);
@@ -1,4 +1,5 @@
 #include <benchmark/benchmark.h>
+#include <fpm/angle.hpp>
 #include <fpm/fixed.hpp>
 #include <fpm/math.hpp>
 #include <fixmath.h>
@@ -37,6 +38,24 @@ static void trigonometry(benchmark::State& state, TValue (*func)(TValue))
     }
 }
 
+// Benchmarks a function of a binary angle, which needs no range reduction
+template <typename TValue>
+static void binary_angle(benchmark::State& state, TValue (*func)(fpm::angle<>))
+{
+    for (auto _ : state)
+    {
+        const auto x = fpm::angle<>::from_raw_value(s_x * 0x00A2F983u);
+        benchmark::DoNotOptimize(func(x));
+    }
+}
+
+// Converts radians to a binary angle before calling the function
+template <typename TValue, TValue (*func)(fpm::angle<>)>
+static TValue radians_proxy(TValue value)
+{
+    return func(fpm::angle<>(value));
+}
+
 template <typename TValue, TValue (*func)(TValue, TValue)>
 static TValue func2_proxy(TValue value)
 {
@@ -68,6 +87,10 @@ BENCHMARK_TEMPLATE1_CAPTURE(trigonometry, acos, fpm::fixed_16_16, &fpm::acos);
 BENCHMARK_TEMPLATE1_CAPTURE(trigonometry, atan, fpm::fixed_16_16, &fpm::atan);
 BENCHMARK_TEMPLATE1_CAPTURE(trigonometry, atan2, fpm::fixed_16_16, &func2_proxy<fpm::fixed_16_16, &fpm::atan2>);
 
+BENCHMARK_TEMPLATE1_CAPTURE(binary_angle, sin, fpm::fixed_16_16, &fpm::sin<fpm::fixed_16_16, std::uint32_t>);
+BENCHMARK_TEMPLATE1_CAPTURE(binary_angle, cos, fpm::fixed_16_16, &fpm::cos<fpm::fixed_16_16, std::uint32_t>);
+BENCHMARK_TEMPLATE1_CAPTURE(trigonometry, sin_angle, fpm::fixed_16_16, &radians_proxy<fpm::fixed_16_16, &fpm::sin<fpm::fixed_16_16, std::uint32_t>>);
+
 BENCHMARK_TEMPLATE1_CAPTURE(trigonometry, sin,  Fix16, fix16_func1<&Fix16::sin>);
 BENCHMARK_TEMPLATE1_CAPTURE(trigonometry, cos,  Fix16, fix16_func1<&Fix16::cos>);
 BENCHMARK_TEMPLATE1_CAPTURE(trigonometry, tan,  Fix16, fix16_func1<&Fix16::tan>);
@@ -0,0 +1,200 @@
+#ifndef FPM_ANGLE_HPP
+#define FPM_ANGLE_HPP
+
+#include "fixed.hpp"
+#include "math.hpp"
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace fpm
+{
+
+//! Binary angle type, where one full turn is 2^N raw units for an N-bit BaseType.
+//! Angles wrap around through unsigned overflow, so sums, differences and multiples of angles
+//! never need a range reduction. This makes it suitable for phase accumulators and headings.
+//! \tparam BaseType the unsigned integer type used to store the angle, of at most 32 bits
+template <typename BaseType = std::uint32_t>
+class angle
+{
+    static_assert(std::is_integral<BaseType>::value && std::is_unsigned<BaseType>::value, "BaseType must be an unsigned integral type");
+    static_assert(std::numeric_limits<BaseType>::digits <= 32, "BaseType must not be larger than 32 bits");
+
+    static constexpr unsigned int DIGITS = std::numeric_limits<BaseType>::digits;
+
+    struct raw_construct_tag {};
+    constexpr inline angle(BaseType val, raw_construct_tag) noexcept : m_value(val) {}
+
+public:
+    inline angle() noexcept = default;
+
+    // Converts an angle in radians to a binary angle.
+    // Whole turns are discarded, so any value is valid. The result is rounded if the
+    // fixed-point type rounds, and truncated otherwise.
+    template <typename B, typename I, unsigned int F, bool R>
+    inline explicit angle(fixed<B, I, F, R> radians) noexcept
+    {
+        static_assert(F < 64, "FractionBits must be less than 64");
+        static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+        m_value = static_cast<BaseType>(detail::radians_to_turn<R>(radians.raw_value(), F, DIGITS));
+    }
+
+    // Converts from a binary angle with a different number of bits.
+    // Like static_cast, this truncates bits that don't fit.
+    template <typename B>
+    constexpr inline explicit angle(angle<B> val) noexcept
+        : m_value(static_cast<BaseType>((static_cast<std::uint32_t>(val.raw_value()) << (32 - std::numeric_limits<B>::digits)) >> (32 - DIGITS)))
+    {}
+
+    // Explicit conversion to radians, in the range [-pi, pi).
+    // The fixed-point type must be able to represent pi.
+    template <typename B, typename I, unsigned int F, bool R>
+    inline explicit operator fixed<B, I, F, R>() const noexcept
+    {
+        static_assert(F < 61, "FractionBits must be less than 61");
+
+        // The angle as a signed fraction of half a turn, times pi as Q2.30
+        constexpr std::uint32_t PI = 3373259426u;
+        const std::uint32_t turn = static_cast<std::uint32_t>(m_value) << (32 - DIGITS);
+        const std::int64_t half_turns = static_cast<std::int64_t>(turn) - ((turn >> 31) ? (std::int64_t{1} << 32) : 0);
+        return fixed<B, I, F, R>::from_raw_value(static_cast<B>(detail::mul_shift<R>(half_turns, PI, 61 - static_cast<int>(F))));
+    }
+
+    // Returns the raw underlying value of this type.
+    // Do not use this unless you know what you're doing.
+    constexpr inline BaseType raw_value() const noexcept
+    {
+        return m_value;
+    }
+
+    // Constructs an angle from its raw underlying value.
+    // Do not use this unless you know what you're doing.
+    static constexpr inline angle from_raw_value(BaseType value) noexcept
+    {
+        return angle(value, raw_construct_tag{});
+    }
+
+    //
+    // Constants
+    //
+    static constexpr angle half_turn() { return angle(static_cast<BaseType>(BaseType{1} << (DIGITS - 1)), raw_construct_tag{}); }
+    static constexpr angle quarter_turn() { return angle(static_cast<BaseType>(BaseType{1} << (DIGITS - 2)), raw_construct_tag{}); }
+
+    //
+    // Arithmetic member operators
+    //
+
+    constexpr inline angle operator-() const noexcept
+    {
+        return angle::from_raw_value(static_cast<BaseType>(0u - m_value));
+    }
+
+    inline angle& operator+=(const angle& y) noexcept
+    {
+        m_value = static_cast<BaseType>(m_value + y.m_value);
+        return *this;
+    }
+
+    inline angle& operator-=(const angle& y) noexcept
+    {
+        m_value = static_cast<BaseType>(m_value - y.m_value);
+        return *this;
+    }
+
+    template <typename I, typename std::enable_if<std::is_integral<I>::value>::type* = nullptr>
+    inline angle& operator*=(I y) noexcept
+    {
+        // Multiply as a 64-bit unsigned value, so that promoted operands can't overflow
+        m_value = static_cast<BaseType>(static_cast<std::uint64_t>(m_value) * static_cast<std::uint64_t>(y));
+        return *this;
+    }
+
+private:
+    BaseType m_value;
+};
+
+//
+// Arithmetic operators
+//
+
+template <typename B>
+inline angle<B> operator+(const angle<B>& x, const angle<B>& y) noexcept
+{
+    return angle<B>(x) += y;
+}
+
+template <typename B>
+inline angle<B> operator-(const angle<B>& x, const angle<B>& y) noexcept
+{
+    return angle<B>(x) -= y;
+}
+
+template <typename B, typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
+inline angle<B> operator*(const angle<B>& x, T y) noexcept
+{
+    return angle<B>(x) *= y;
+}
+
+template <typename B, typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
+inline angle<B> operator*(T x, const angle<B>& y) noexcept
+{
+    return angle<B>(y) *= x;
+}
+
+//
+// Comparison operators
+//
+
+template <typename B>
+constexpr inline bool operator==(const angle<B>& x, const angle<B>& y) noexcept
+{
+    return x.raw_value() == y.raw_value();
+}
+
+template <typename B>
+constexpr inline bool operator!=(const angle<B>& x, const angle<B>& y) noexcept
+{
+    return x.raw_value() != y.raw_value();
+}
+
+//
+// Trigonometry functions
+//
+
+// Calculates the sine of a binary angle as a fixed-point number, e.g. sin<fixed_16_16>(x).
+// Unlike sin on radians, this needs no range reduction.
+template <typename Fixed, typename B>
+inline Fixed sin(angle<B> x) noexcept
+{
+    std::int64_t s, c;
+    detail::sincos_turn(angle<std::uint32_t>(x).raw_value(), &s, &c);
+    Fixed result;
+    detail::from_q31(s, &result);
+    return result;
+}
+
+// Calculates the cosine of a binary angle as a fixed-point number, e.g. cos<fixed_16_16>(x).
+template <typename Fixed, typename B>
+inline Fixed cos(angle<B> x) noexcept
+{
+    std::int64_t s, c;
+    detail::sincos_turn(angle<std::uint32_t>(x).raw_value(), &s, &c);
+    Fixed result;
+    detail::from_q31(c, &result);
+    return result;
+}
+
+// Calculates both the sine and the cosine of a binary angle, sharing the table lookups.
+template <typename B, typename Fixed>
+inline void sincos(angle<B> x, Fixed* s, Fixed* c) noexcept
+{
+    assert(s != nullptr && c != nullptr);
+    std::int64_t s_raw, c_raw;
+    detail::sincos_turn(angle<std::uint32_t>(x).raw_value(), &s_raw, &c_raw);
+    detail::from_q31(s_raw, s);
+    detail::from_q31(c_raw, c);
+}
+
+} // namespace fpm
+
+#endif
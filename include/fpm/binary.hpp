@@ -0,0 +1,299 @@
+#ifndef FPM_BINARY_HPP
+#define FPM_BINARY_HPP
+
+#include "fixed.hpp"
+#include "mapped_file.hpp"
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fpm
+{
+
+//! Binary files of fixed-point arrays.
+//! A file starts with a 64-byte header that records the fixed-point format of the values and their count,
+//! followed by the raw values in the byte order of the machine that wrote them:
+//!
+//!   offset  size  content
+//!        0     4  "FPMA"
+//!        4     1  format version (1)
+//!        5     1  byte order of the values: 0 for little-endian, 1 for big-endian
+//!        6     1  size of BaseType in bytes
+//!        7     1  1 if BaseType is signed, otherwise 0
+//!        8     1  FractionBits
+//!        9     1  1 if EnableRounding, otherwise 0
+//!       16     8  number of values, little-endian
+//!       64        the values
+//!
+//! The remaining bytes of the header are zero.
+namespace binary
+{
+
+// The fixed-point format of the values in a file
+struct format
+{
+    bool big_endian;
+    unsigned int base_size;  // the size of BaseType in bytes
+    bool is_signed;
+    unsigned int fraction_bits;
+    bool rounding;
+    std::uint64_t count;     // the number of values
+};
+
+namespace detail
+{
+
+constexpr std::size_t header_size = 64;
+constexpr unsigned char version = 1;
+
+inline bool is_big_endian() noexcept
+{
+    const std::uint16_t value = 1;
+    unsigned char first;
+    std::memcpy(&first, &value, 1);
+    return first == 0;
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+format format_of(std::uint64_t count) noexcept
+{
+    return format{ is_big_endian(), sizeof(B), std::is_signed<B>::value, F, R, count };
+}
+
+inline void encode_header(const format& fmt, unsigned char (&header)[header_size]) noexcept
+{
+    std::memset(header, 0, header_size);
+    std::memcpy(header, "FPMA", 4);
+    header[4] = version;
+    header[5] = fmt.big_endian ? 1 : 0;
+    header[6] = static_cast<unsigned char>(fmt.base_size);
+    header[7] = fmt.is_signed ? 1 : 0;
+    header[8] = static_cast<unsigned char>(fmt.fraction_bits);
+    header[9] = fmt.rounding ? 1 : 0;
+    for (int i = 0; i < 8; ++i) {
+        header[16 + i] = static_cast<unsigned char>(fmt.count >> (i * 8));
+    }
+}
+
+// Decodes the header of a file of `size` bytes. Returns false if it isn't a valid header for that size.
+inline bool decode_header(const unsigned char* header, std::size_t size, format& fmt) noexcept
+{
+    if (size < header_size || std::memcmp(header, "FPMA", 4) != 0 || header[4] != version || header[5] > 1) {
+        return false;
+    }
+    fmt.big_endian = (header[5] != 0);
+    fmt.base_size = header[6];
+    fmt.is_signed = (header[7] != 0);
+    fmt.fraction_bits = header[8];
+    fmt.rounding = (header[9] != 0);
+    fmt.count = 0;
+    for (int i = 7; i >= 0; --i) {
+        fmt.count = (fmt.count << 8) | header[16 + i];
+    }
+    const auto data_size = static_cast<std::uint64_t>(size - header_size);
+    return fmt.base_size > 0 && fmt.count <= data_size / fmt.base_size && fmt.count * fmt.base_size == data_size;
+}
+
+// Checks that values of the format can be read as fixed<B, I, F, R>, except for their byte order.
+// The rounding flag doesn't affect the representation, so it's allowed to differ.
+template <typename B, typename I, unsigned int F, bool R>
+bool is_compatible(const format& fmt) noexcept
+{
+    return fmt.base_size == sizeof(B) && fmt.is_signed == std::is_signed<B>::value && fmt.fraction_bits == F;
+}
+
+template <typename B>
+B byte_swap(B value) noexcept
+{
+    using U = typename std::make_unsigned<B>::type;
+    U bits = static_cast<U>(value);
+    U swapped = 0;
+    for (std::size_t i = 0; i < sizeof(B); ++i) {
+        swapped = static_cast<U>((swapped << 8) | (bits & 0xFF));
+        bits = static_cast<U>(bits >> 8);
+    }
+    return static_cast<B>(swapped);
+}
+
+}
+
+// Writes `count` values to a file at `path`, replacing it if it exists.
+// Returns std::errc{} on success, or the reason of failure.
+template <typename B, typename I, unsigned int F, bool R>
+std::errc write(const char* path, const fixed<B, I, F, R>* values, std::size_t count)
+{
+    static_assert(sizeof(fixed<B, I, F, R>) == sizeof(B), "fixed must have the size of its BaseType");
+
+    std::FILE* const file = std::fopen(path, "wb");
+    if (file == nullptr) {
+        return static_cast<std::errc>(errno);
+    }
+    unsigned char header[detail::header_size];
+    detail::encode_header(detail::format_of<B, I, F, R>(count), header);
+    // Without values, the pointer may be null, which fwrite doesn't accept
+    bool ok = std::fwrite(header, 1, sizeof(header), file) == sizeof(header)
+           && (count == 0 || std::fwrite(values, sizeof(B), count, file) == count);
+    ok = (std::fclose(file) == 0) && ok;
+    return ok ? std::errc{} : std::errc::io_error;
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+std::errc write(const char* path, const std::vector<fixed<B, I, F, R>>& values)
+{
+    return write(path, values.data(), values.size());
+}
+
+// Reads the format of the values in the file at `path`.
+// Returns std::errc{} on success, illegal_byte_sequence if the file isn't a valid binary file,
+// or the reason the file couldn't be read.
+inline std::errc read_format(const char* path, format& fmt)
+{
+    fpm::detail::mapped_file file;
+    const auto ec = file.open(path);
+    if (ec != std::errc{}) {
+        return ec;
+    }
+    if (!detail::decode_header(reinterpret_cast<const unsigned char*>(file.data()), file.size(), fmt)) {
+        return std::errc::illegal_byte_sequence;
+    }
+    return std::errc{};
+}
+
+// Reads the values in the file at `path`, converting them from the byte order of the file.
+// Returns std::errc{} on success, illegal_byte_sequence if the file isn't a valid binary file,
+// invalid_argument if its values have a different fixed-point format, or the reason the file couldn't be read.
+template <typename B, typename I, unsigned int F, bool R>
+std::errc read(const char* path, std::vector<fixed<B, I, F, R>>& values)
+{
+    fpm::detail::mapped_file file;
+    auto ec = file.open(path);
+    if (ec != std::errc{}) {
+        return ec;
+    }
+
+    format fmt;
+    if (!detail::decode_header(reinterpret_cast<const unsigned char*>(file.data()), file.size(), fmt)) {
+        return std::errc::illegal_byte_sequence;
+    }
+    if (!detail::is_compatible<B, I, F, R>(fmt)) {
+        return std::errc::invalid_argument;
+    }
+
+    const char* data = file.data() + detail::header_size;
+    values.resize(static_cast<std::size_t>(fmt.count));
+    if (fmt.count > 0) {
+        std::memcpy(values.data(), data, static_cast<std::size_t>(fmt.count) * sizeof(B));
+    }
+    if (fmt.big_endian != detail::is_big_endian()) {
+        for (auto& value : values) {
+            value = fixed<B, I, F, R>::from_raw_value(detail::byte_swap(value.raw_value()));
+        }
+    }
+    return std::errc{};
+}
+
+//! A read-only view of the values in a binary file, which maps the file into memory instead of copying it.
+//! Like std::span<const Fixed>, it provides the values as a contiguous array.
+//! \tparam Fixed the fixed-point type of the values
+template <typename Fixed>
+class view;
+
+template <typename B, typename I, unsigned int F, bool R>
+class view<fixed<B, I, F, R>>
+{
+public:
+    using element_type = const fixed<B, I, F, R>;
+    using value_type = fixed<B, I, F, R>;
+    using size_type = std::size_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+    using iterator = const value_type*;
+
+    view() noexcept = default;
+
+    // Takes over the mapping of `other`, which is left empty
+    view(view&& other) noexcept
+        : m_file(std::move(other.m_file)), m_data(other.m_data), m_size(other.m_size)
+    {
+        other.m_data = nullptr;
+        other.m_size = 0;
+    }
+
+    view& operator=(view&& other) noexcept
+    {
+        if (this != &other) {
+            m_file = std::move(other.m_file);
+            m_data = other.m_data;
+            m_size = other.m_size;
+            other.m_data = nullptr;
+            other.m_size = 0;
+        }
+        return *this;
+    }
+
+    // Maps the file at `path`.
+    // Returns std::errc{} on success, illegal_byte_sequence if the file isn't a valid binary file,
+    // invalid_argument if its values have a different fixed-point format or byte order,
+    // or the reason the file couldn't be mapped. On failure, the view is empty.
+    std::errc open(const char* path) noexcept
+    {
+        static_assert(sizeof(value_type) == sizeof(B), "fixed must have the size of its BaseType");
+
+        close();
+        auto ec = m_file.open(path);
+        if (ec != std::errc{}) {
+            return ec;
+        }
+
+        format fmt;
+        if (!detail::decode_header(reinterpret_cast<const unsigned char*>(m_file.data()), m_file.size(), fmt)) {
+            ec = std::errc::illegal_byte_sequence;
+        } else if (!detail::is_compatible<B, I, F, R>(fmt) || fmt.big_endian != detail::is_big_endian()) {
+            ec = std::errc::invalid_argument;
+        } else {
+            // Mappings start on a page boundary, so the values are aligned
+            m_data = reinterpret_cast<pointer>(m_file.data() + detail::header_size);
+            m_size = static_cast<size_type>(fmt.count);
+            return std::errc{};
+        }
+        m_file.close();
+        return ec;
+    }
+
+    void close() noexcept
+    {
+        m_file.close();
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    pointer data() const noexcept { return m_data; }
+    size_type size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+
+    iterator begin() const noexcept { return m_data; }
+    iterator end() const noexcept { return m_data + m_size; }
+
+    reference operator[](size_type index) const noexcept
+    {
+        assert(index < m_size);
+        return m_data[index];
+    }
+
+private:
+    fpm::detail::mapped_file m_file;
+    pointer m_data = nullptr;
+    size_type m_size = 0;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,699 @@
+#ifndef FPM_CHARCONV_HPP
+#define FPM_CHARCONV_HPP
+
+#include "fixed.hpp"
+#include "math.hpp"
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+
+namespace fpm
+{
+
+// Formats of to_chars and from_chars, like std::chars_format (which requires C++17)
+enum class chars_format
+{
+    scientific = 1,
+    fixed = 2,
+    hex = 4,
+    general = fixed | scientific
+};
+
+struct to_chars_result
+{
+    char* ptr;
+    std::errc ec;
+};
+
+struct from_chars_result
+{
+    const char* ptr;
+    std::errc ec;
+};
+
+//
+// Helper functions
+//
+namespace detail
+{
+
+// Returns the magnitude of a raw value
+template <typename B>
+inline std::uint64_t magnitude(B value) noexcept
+{
+    return (value < 0) ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+}
+
+// The decimal expansion of a magnitude with F fraction bits, as digit values.
+// The first digit is a zero, so rounding can carry into it. Digits beyond `size` are zero.
+template <unsigned int F>
+struct decimal_digits
+{
+    static_assert(F < 60, "FractionBits must be less than 60");
+
+    // A leading zero, up to 20 integral digits, and a fraction of F bits has F digits
+    std::array<char, 21 + F> digits;
+    int size;  // number of digits
+    int point; // number of digits before the decimal point
+
+    // Calculates the exact expansion
+    explicit decimal_digits(std::uint64_t magnitude) noexcept
+    {
+        constexpr std::uint64_t MASK = (std::uint64_t{1} << F) - 1;
+        set_integral(magnitude >> F);
+
+        // The fraction terminates after at most F digits
+        for (std::uint64_t fraction = magnitude & MASK; fraction != 0; fraction &= MASK) {
+            fraction *= 10;
+            digits[size++] = static_cast<char>(fraction >> F);
+        }
+    }
+
+    // Calculates the shortest expansion that converts back to the magnitude. A conversion with rounding
+    // accepts values less than half a step away, and exactly half a step below (ties away from zero).
+    // A conversion without rounding accepts values from the magnitude up to the next step.
+    // Of the shortest candidates, the nearest is chosen.
+    decimal_digits(std::uint64_t magnitude, bool round) noexcept
+    {
+        // The fraction and the distances to the bounds of the accepted interval, in units of 2^-(F+1).
+        // After every digit, all three are scaled by 10.
+        constexpr std::uint64_t ONE = std::uint64_t{1} << (F + 1);
+        std::uint64_t fraction = (magnitude << 1) & (ONE - 1);
+        std::uint64_t below = round ? 1 : 0;
+        std::uint64_t above = round ? 1 : 2;
+        set_integral(magnitude >> F);
+
+        for (;;) {
+            // Can we truncate here, or round up the last digit?
+            const bool down = fraction <= below;
+            const bool up = fraction + above > ONE;
+            if (down || up) {
+                if (up && (!down || 2 * fraction > ONE || (2 * fraction == ONE && digits[size - 1] % 2 != 0))) {
+                    increment();
+                    while (size > point && digits[size - 1] == 0) {
+                        --size;
+                    }
+                }
+                break;
+            }
+            fraction *= 10;
+            below *= 10;
+            above *= 10;
+            digits[size++] = static_cast<char>(fraction >> (F + 1));
+            fraction &= ONE - 1;
+        }
+    }
+
+    int operator[](int index) const noexcept
+    {
+        return (index < size) ? digits[index] : 0;
+    }
+
+    // Returns the index of the first non-zero digit, or `size` if all digits are zero
+    int first_significant() const noexcept
+    {
+        int index = 0;
+        while (index < size && digits[index] == 0) {
+            ++index;
+        }
+        return index;
+    }
+
+    // Rounds to the first `count` digits, to nearest with ties to even, like printf
+    void round(int count) noexcept
+    {
+        assert(count > 0);
+        if (count >= size) {
+            return;
+        }
+
+        bool increment = digits[count] > 5;
+        if (digits[count] == 5) {
+            increment = (digits[count - 1] % 2) != 0;
+            for (int i = count + 1; i < size; ++i) {
+                if (digits[i] != 0) {
+                    increment = true;
+                    break;
+                }
+            }
+        }
+        size = count;
+        if (increment) {
+            this->increment();
+        }
+    }
+
+private:
+    // Writes the integral digits after the leading zero
+    void set_integral(std::uint64_t integral) noexcept
+    {
+        int count = 0;
+        for (auto value = integral; value != 0 || count == 0; value /= 10) {
+            ++count;
+        }
+        point = size = count + 1;
+        digits[0] = 0;
+        for (int i = point - 1; i > 0; --i, integral /= 10) {
+            digits[i] = static_cast<char>(integral % 10);
+        }
+    }
+
+    // Increments the last digit, carrying into the previous digits
+    void increment() noexcept
+    {
+        int i = size - 1;
+        while (digits[i] == 9) {
+            digits[i--] = 0;
+        }
+        assert(i >= 0);
+        ++digits[i];
+    }
+};
+
+// Returns the number of decimal digits of a non-negative value, at least `min_digits`
+inline int digit_count(int value, int min_digits) noexcept
+{
+    int count = 1;
+    for (; value >= 10; value /= 10) {
+        ++count;
+    }
+    return (count < min_digits) ? min_digits : count;
+}
+
+// Writes an exponent such as "e+05", with at least `min_digits` digits, and returns the end of the output
+inline char* write_exponent(char* p, char prefix, int exponent, int min_digits) noexcept
+{
+    *p++ = prefix;
+    *p++ = (exponent < 0) ? '-' : '+';
+    exponent = (exponent < 0) ? -exponent : exponent;
+    const int count = digit_count(exponent, min_digits);
+    for (int i = count - 1; i >= 0; --i, exponent /= 10) {
+        p[i] = static_cast<char>('0' + exponent % 10);
+    }
+    return p + count;
+}
+
+// Writes the rounded digits in fixed notation with `precision` fraction digits.
+// If `strip` is true, trailing zeros and a trailing decimal point are omitted.
+template <unsigned int F>
+to_chars_result write_fixed(char* first, char* last, bool negative, decimal_digits<F>& d, int precision, bool strip) noexcept
+{
+    d.round(d.point + precision);
+
+    // Keep at most one leading zero
+    int start = d.first_significant();
+    start = (start < d.point - 1) ? start : d.point - 1;
+    if (strip) {
+        while (precision > 0 && d[d.point + precision - 1] == 0) {
+            --precision;
+        }
+    }
+
+    const auto length = (negative ? 1 : 0) + (d.point - start) + (precision > 0 ? precision + 1 : 0);
+    if (last - first < length) {
+        return { last, std::errc::value_too_large };
+    }
+
+    char* p = first;
+    if (negative) {
+        *p++ = '-';
+    }
+    for (int i = start; i < d.point; ++i) {
+        *p++ = static_cast<char>('0' + d[i]);
+    }
+    if (precision > 0) {
+        *p++ = '.';
+        for (int i = 0; i < precision; ++i) {
+            *p++ = static_cast<char>('0' + d[d.point + i]);
+        }
+    }
+    return { p, std::errc{} };
+}
+
+// Writes a magnitude with F fraction bits in fixed notation with up to 9 fraction digits, like write_fixed,
+// without calculating its exact expansion. Returns false if the scaled magnitude doesn't fit in 64 bits.
+template <unsigned int F>
+bool write_fixed_scaled(char* first, char* last, bool negative, std::uint64_t magnitude, int precision, to_chars_result* result) noexcept
+{
+    static constexpr std::uint64_t POWERS_OF_10[] = {
+        1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+    };
+    if (precision > 9 || magnitude > std::numeric_limits<std::uint64_t>::max() / POWERS_OF_10[precision]) {
+        return false;
+    }
+
+    // Round the scaled magnitude to an integer, to nearest with ties to even.
+    // Without fraction bits, it's an integer already.
+    const std::uint64_t scale = POWERS_OF_10[precision];
+    const std::uint64_t scaled = magnitude * scale;
+    std::uint64_t value = scaled >> F;
+    if (F > 0) {
+        const std::uint64_t remainder = scaled & ((std::uint64_t{1} << F) - 1);
+        const std::uint64_t half = std::uint64_t{1} << (F > 0 ? F - 1 : 0);
+        if (remainder > half || (remainder == half && (value & 1) != 0)) {
+            ++value;
+        }
+    }
+
+    std::uint64_t integral = value / scale;
+    std::uint64_t fraction = value % scale;
+    int integral_digits = 1;
+    for (auto v = integral; v >= 10; v /= 10) {
+        ++integral_digits;
+    }
+    const auto length = (negative ? 1 : 0) + integral_digits + (precision > 0 ? precision + 1 : 0);
+    if (last - first < length) {
+        *result = { last, std::errc::value_too_large };
+        return true;
+    }
+
+    char* p = first + length;
+    for (int i = 0; i < precision; ++i, fraction /= 10) {
+        *--p = static_cast<char>('0' + fraction % 10);
+    }
+    if (precision > 0) {
+        *--p = '.';
+    }
+    do {
+        *--p = static_cast<char>('0' + integral % 10);
+        integral /= 10;
+    } while (integral != 0);
+    if (negative) {
+        *--p = '-';
+    }
+    *result = { first + length, std::errc{} };
+    return true;
+}
+
+// Writes the digits in scientific notation with `precision` digits after the decimal point, like printf's %e.
+// If `strip` is true, trailing zeros and a trailing decimal point are omitted.
+template <unsigned int F>
+to_chars_result write_scientific(char* first, char* last, bool negative, decimal_digits<F>& d, int precision, bool strip) noexcept
+{
+    int start = d.first_significant();
+    if (start < d.size) {
+        // Rounding can carry into the digit before the first significant digit
+        d.round(start + precision + 1);
+        start = d.first_significant();
+    }
+    const int exponent = (start < d.size) ? d.point - 1 - start : 0;
+    if (strip) {
+        while (precision > 0 && d[start + precision] == 0) {
+            --precision;
+        }
+    }
+
+    const auto length = (negative ? 1 : 0) + 1 + (precision > 0 ? precision + 1 : 0) + 2 + digit_count(exponent < 0 ? -exponent : exponent, 2);
+    if (last - first < length) {
+        return { last, std::errc::value_too_large };
+    }
+
+    char* p = first;
+    if (negative) {
+        *p++ = '-';
+    }
+    *p++ = static_cast<char>('0' + d[start]);
+    if (precision > 0) {
+        *p++ = '.';
+        for (int i = 1; i <= precision; ++i) {
+            *p++ = static_cast<char>('0' + d[start + i]);
+        }
+    }
+    return { write_exponent(p, 'e', exponent, 2), std::errc{} };
+}
+
+// Writes a magnitude with F fraction bits in hexadecimal scientific notation, like printf's %a without "0x".
+// The leading digit is 1 for non-zero values. A negative precision writes all significant digits.
+template <unsigned int F>
+to_chars_result write_hex(char* first, char* last, bool negative, std::uint64_t magnitude, int precision) noexcept
+{
+    // The fraction of the normalized value, left-aligned in 64 bits
+    std::uint64_t fraction = 0;
+    int exponent = 0;
+    int lead = 0;
+    int digits = 0;
+    if (magnitude != 0) {
+        const auto bit = static_cast<int>(find_highest_bit(magnitude));
+        fraction = (bit > 0) ? magnitude << (64 - bit) : 0;
+        exponent = bit - static_cast<int>(F);
+        lead = 1;
+        digits = (bit + 3) / 4;
+    }
+
+    if (precision >= 0 && precision < digits) {
+        // Round to nearest, with ties to even
+        const std::uint64_t kept = (precision > 0) ? fraction >> (64 - 4 * precision) : 0;
+        const std::uint64_t rest = fraction << (4 * precision);
+        const std::uint64_t HALF = std::uint64_t{1} << 63;
+        const bool increment = rest > HALF || (rest == HALF && ((precision > 0 ? kept : lead) & 1) != 0);
+        fraction = (precision > 0) ? kept << (64 - 4 * precision) : 0;
+        if (increment) {
+            fraction += (precision > 0) ? std::uint64_t{1} << (64 - 4 * precision) : 0;
+            if (fraction == 0) {
+                // The carry reached the leading digit, so renormalize
+                ++exponent;
+            }
+        }
+        digits = precision;
+    }
+    if (precision < 0) {
+        // Omit trailing zeros
+        while (digits > 0 && ((fraction >> (64 - 4 * digits)) & 15) == 0) {
+            --digits;
+        }
+        precision = digits;
+    }
+
+    const auto length = (negative ? 1 : 0) + 1 + (precision > 0 ? precision + 1 : 0) + 2 + digit_count(exponent < 0 ? -exponent : exponent, 1);
+    if (last - first < length) {
+        return { last, std::errc::value_too_large };
+    }
+
+    char* p = first;
+    if (negative) {
+        *p++ = '-';
+    }
+    *p++ = static_cast<char>('0' + lead);
+    if (precision > 0) {
+        *p++ = '.';
+        for (int i = 0; i < precision; ++i) {
+            *p++ = (i < 16) ? "0123456789abcdef"[(fraction >> (60 - 4 * i)) & 15] : '0';
+        }
+    }
+    return { write_exponent(p, 'p', exponent, 1), std::errc{} };
+}
+
+// Writes the shortest digits in the notation of `fmt`, with as many digits as there are significant digits.
+// If `choose` is true, the shorter of the fixed and scientific notations is used, preferring fixed, like std::to_chars.
+template <unsigned int F>
+to_chars_result write_shortest(char* first, char* last, bool negative, decimal_digits<F>& d, chars_format fmt, bool choose) noexcept
+{
+    // Trailing zeros in the integral part are not significant
+    const int start = d.first_significant();
+    int end = d.size;
+    while (end > start && d.digits[end - 1] == 0) {
+        --end;
+    }
+    const int significant = (start < end) ? end - start : 1;
+    const int exponent = (start < end) ? d.point - 1 - start : 0;
+    const int fraction_digits = (d.size > d.point) ? d.size - d.point : 0;
+
+    if (choose) {
+        const int fixed_length = d.point - ((start < d.point - 1) ? start : d.point - 1) + (fraction_digits > 0 ? fraction_digits + 1 : 0);
+        const int scientific_length = 1 + (significant > 1 ? significant : 0) + 2 + digit_count(exponent < 0 ? -exponent : exponent, 2);
+        fmt = (fixed_length <= scientific_length) ? chars_format::fixed : chars_format::scientific;
+    } else if (fmt == chars_format::general) {
+        // Like std::to_chars, choose the notation like %g with its default precision of 6
+        fmt = (exponent < 6 && exponent >= -4) ? chars_format::fixed : chars_format::scientific;
+    }
+    return (fmt == chars_format::fixed) ? write_fixed(first, last, negative, d, fraction_digits, false)
+                                        : write_scientific(first, last, negative, d, significant - 1, false);
+}
+
+// Returns the value of a digit in `base`, or `base` if the character isn't a digit
+inline unsigned int digit_value(char ch, unsigned int base) noexcept
+{
+    unsigned int value = base;
+    if (ch >= '0' && ch <= '9') {
+        value = static_cast<unsigned int>(ch - '0');
+    } else if (ch >= 'a' && ch <= 'f') {
+        value = static_cast<unsigned int>(ch - 'a' + 10);
+    } else if (ch >= 'A' && ch <= 'F') {
+        value = static_cast<unsigned int>(ch - 'A' + 10);
+    }
+    return (value < base) ? value : base;
+}
+
+// The digits of a parsed number, excluding the decimal point, and its exponent
+struct parsed_number
+{
+    const char* integral;   // start of the integral digits
+    const char* point;      // end of the integral digits
+    const char* fraction;   // start of the fraction digits
+    const char* end;        // end of the fraction digits
+    long exponent;          // the exponent, limited to a magnitude of about 10^6
+};
+
+// Parses the significand and exponent in `base`, and returns the end of the match or nullptr if there is none.
+// If `exponent_char` is '\0', no exponent is parsed. If `exponent_required` is true, it must be present.
+inline const char* parse_number(const char* first, const char* last, unsigned int base, char exponent_char,
+                                bool exponent_required, parsed_number* number) noexcept
+{
+    const char* p = first;
+    number->integral = p;
+    while (p != last && digit_value(*p, base) < base) {
+        ++p;
+    }
+    number->point = number->fraction = number->end = p;
+    if (p != last && *p == '.') {
+        number->fraction = ++p;
+        while (p != last && digit_value(*p, base) < base) {
+            ++p;
+        }
+        number->end = p;
+    }
+    if (number->point == number->integral && number->end == number->fraction) {
+        // We need a significand
+        return nullptr;
+    }
+
+    number->exponent = 0;
+    if (exponent_char != '\0' && p != last && (*p == exponent_char || *p == exponent_char - 'a' + 'A')) {
+        const char* q = p + 1;
+        const bool negative = (q != last && *q == '-');
+        if (q != last && (*q == '-' || *q == '+')) {
+            ++q;
+        }
+        if (q != last && *q >= '0' && *q <= '9') {
+            for (; q != last && *q >= '0' && *q <= '9'; ++q) {
+                if (number->exponent < 1000000) {
+                    number->exponent = number->exponent * 10 + (*q - '0');
+                }
+            }
+            number->exponent = negative ? -number->exponent : number->exponent;
+            return q;
+        }
+    }
+    return exponent_required ? nullptr : p;
+}
+
+// Converts a parsed decimal number to a magnitude with F fraction bits, rounded if Round is true.
+// Returns false if the magnitude is larger than `max`.
+template <unsigned int F, bool Round>
+bool decimal_to_magnitude(const parsed_number& number, std::uint64_t max, std::uint64_t* magnitude) noexcept
+{
+    static_assert(F < 63, "FractionBits must be less than 63");
+
+    // The fraction is kept exactly, in chunks of 9 digits. An exact multiple of 2^-(F+1), which decides
+    // the rounding, has at most F+1 fraction digits, so later digits cannot change the result.
+    constexpr int CHUNKS = (F + 9) / 9;
+    constexpr std::uint32_t POW10[9] = { 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1 };
+    std::array<std::uint32_t, CHUNKS> chunks{};
+
+    const std::uint64_t max_integral = max >> F;
+    std::uint64_t integral = 0;
+
+    // Position of each digit relative to the decimal point: negative positions are integral
+    const long integral_digits = static_cast<long>(number.point - number.integral);
+    long position = -integral_digits - number.exponent;
+    const auto add_digit = [&](char ch) {
+        const auto digit = static_cast<std::uint32_t>(ch - '0');
+        if (position < 0) {
+            if (integral > max_integral / 10 || integral * 10 + digit > max_integral) {
+                return false;
+            }
+            integral = integral * 10 + digit;
+        } else if (position < CHUNKS * 9) {
+            chunks[position / 9] += digit * POW10[position % 9];
+        }
+        ++position;
+        return true;
+    };
+    for (auto p = number.integral; p != number.point; ++p) {
+        if (!add_digit(*p)) {
+            return false;
+        }
+    }
+    for (auto p = number.fraction; p != number.end; ++p) {
+        if (!add_digit(*p)) {
+            return false;
+        }
+    }
+    for (; position < 0 && integral != 0; ++position) {
+        // The exponent moved the decimal point beyond the digits
+        if (integral > max_integral / 10) {
+            return false;
+        }
+        integral *= 10;
+    }
+
+    // Multiply the fraction by 2^(F+1), in steps of at most 2^32 so the products fit in 64 bits.
+    // The carries out of the first chunk form the result.
+    std::uint64_t fraction = 0;
+    for (int remaining = F + 1; remaining > 0;) {
+        const int shift = (remaining < 32) ? remaining : 32;
+        std::uint64_t carry = 0;
+        for (int i = CHUNKS - 1; i >= 0; --i) {
+            const std::uint64_t value = (std::uint64_t{chunks[i]} << shift) + carry;
+            chunks[i] = static_cast<std::uint32_t>(value % 1000000000);
+            carry = value / 1000000000;
+        }
+        fraction = (fraction << shift) + carry;
+        remaining -= shift;
+    }
+
+    // The last bit of the fraction is the rounding bit; rounding ties away from zero, like the conversion from double
+    *magnitude = (integral << F) + (fraction >> 1) + (Round ? (fraction & 1) : 0);
+    return *magnitude <= max;
+}
+
+// Converts a parsed hexadecimal number to a magnitude with F fraction bits, rounded if Round is true.
+// Returns false if the magnitude is larger than `max`.
+template <unsigned int F, bool Round>
+bool hex_to_magnitude(const parsed_number& number, std::uint64_t max, std::uint64_t* magnitude) noexcept
+{
+    // Collect up to 60 significant bits. For base types of up to 32 bits, later digits are below the rounding bit.
+    std::uint64_t mantissa = 0;
+    long exponent = number.exponent;
+    const auto add_digit = [&](char ch, bool fraction) {
+        if (mantissa < (std::uint64_t{1} << 56)) {
+            mantissa = mantissa * 16 + digit_value(ch, 16);
+            exponent -= fraction ? 4 : 0;
+        } else {
+            exponent += fraction ? 0 : 4;
+        }
+    };
+    for (auto p = number.integral; p != number.point; ++p) {
+        add_digit(*p, false);
+    }
+    for (auto p = number.fraction; p != number.end; ++p) {
+        add_digit(*p, true);
+    }
+
+    // The magnitude is mantissa * 2^(exponent + F)
+    *magnitude = 0;
+    if (mantissa != 0) {
+        const long shift = exponent + static_cast<long>(F);
+        if (shift > 0 && find_highest_bit(mantissa) + shift >= 64) {
+            return false;
+        }
+        *magnitude = shift_right<Round>(mantissa, static_cast<int>((shift < -64) ? 64 : -shift));
+    }
+    return *magnitude <= max;
+}
+
+}
+
+// Converts a fixed-point number to characters in [first, last), like printf with the format
+// %f, %e, %g or %a (without the "0x" prefix) and the given precision. A negative precision means 6,
+// except for hexadecimal, where it means as many digits as needed to represent the value exactly.
+// The conversion is exact and rounds to nearest, with ties to even. It is independent of the locale and never allocates.
+// If the output does not fit, returns {last, std::errc::value_too_large}.
+template <typename B, typename I, unsigned int F, bool R>
+to_chars_result to_chars(char* first, char* last, fixed<B, I, F, R> value, chars_format fmt, int precision) noexcept
+{
+    const bool negative = value.raw_value() < 0;
+    const std::uint64_t magnitude = detail::magnitude(value.raw_value());
+
+    if (fmt == chars_format::hex) {
+        return detail::write_hex<F>(first, last, negative, magnitude, precision);
+    }
+
+    precision = (precision < 0) ? 6 : precision;
+    to_chars_result result;
+    if (fmt == chars_format::fixed && detail::write_fixed_scaled<F>(first, last, negative, magnitude, precision, &result)) {
+        return result;
+    }
+
+    detail::decimal_digits<F> digits(magnitude);
+    switch (fmt)
+    {
+    case chars_format::fixed:
+        return detail::write_fixed(first, last, negative, digits, precision, false);
+    case chars_format::scientific:
+        return detail::write_scientific(first, last, negative, digits, precision, false);
+    default:
+    {
+        // Like %g: `precision` is the number of significant digits, and the notation depends on the exponent
+        // of the rounded value.
+        precision = (precision == 0) ? 1 : precision;
+        int start = digits.first_significant();
+        int exponent = 0;
+        if (start < digits.size) {
+            digits.round(start + precision);
+            start = digits.first_significant();
+            exponent = digits.point - 1 - start;
+        }
+        if (exponent < precision && exponent >= -4) {
+            return detail::write_fixed(first, last, negative, digits, precision - 1 - exponent, true);
+        }
+        return detail::write_scientific(first, last, negative, digits, precision - 1, true);
+    }
+    }
+}
+
+// Converts a fixed-point number to the shortest characters in [first, last), in the notation of `fmt`,
+// that from_chars converts back to the same value. Of the shortest candidates, the nearest is chosen.
+// Hexadecimal output has as many digits as needed to represent the value exactly.
+// If the output does not fit, returns {last, std::errc::value_too_large}.
+template <typename B, typename I, unsigned int F, bool R>
+to_chars_result to_chars(char* first, char* last, fixed<B, I, F, R> value, chars_format fmt) noexcept
+{
+    const bool negative = value.raw_value() < 0;
+    const std::uint64_t magnitude = detail::magnitude(value.raw_value());
+    if (fmt == chars_format::hex) {
+        return detail::write_hex<F>(first, last, negative, magnitude, -1);
+    }
+    detail::decimal_digits<F> digits(magnitude, R);
+    return detail::write_shortest(first, last, negative, digits, fmt, false);
+}
+
+// Converts a fixed-point number to the shortest characters in [first, last) that from_chars converts back
+// to the same value. Like std::to_chars, this uses the shorter of the fixed and scientific notations.
+template <typename B, typename I, unsigned int F, bool R>
+to_chars_result to_chars(char* first, char* last, fixed<B, I, F, R> value) noexcept
+{
+    detail::decimal_digits<F> digits(detail::magnitude(value.raw_value()), R);
+    return detail::write_shortest(first, last, value.raw_value() < 0, digits, chars_format::general, true);
+}
+
+// Converts characters in [first, last) to a fixed-point number, like std::from_chars.
+// The syntax is that of strtod without leading whitespace and "+" sign, infinity and NaN. Exponents are only
+// accepted (and required) as fmt allows, and hexadecimal numbers have no "0x" prefix. The result is rounded
+// to nearest (with ties away from zero) if rounding is enabled for the type, and truncated otherwise.
+// It is independent of the locale and never allocates.
+// Returns std::errc::invalid_argument if there is no number, and std::errc::result_out_of_range if
+// it cannot be represented. On error, `value` is not modified.
+template <typename B, typename I, unsigned int F, bool R>
+from_chars_result from_chars(const char* first, const char* last, fixed<B, I, F, R>& value,
+                             chars_format fmt = chars_format::general) noexcept
+{
+    const bool negative = (first != last && *first == '-');
+    const char* const start = negative ? first + 1 : first;
+
+    detail::parsed_number number;
+    const bool hex = (fmt == chars_format::hex);
+    const char exponent_char = hex ? 'p' : ((fmt == chars_format::fixed) ? '\0' : 'e');
+    const char* const end = detail::parse_number(start, last, hex ? 16 : 10, exponent_char, fmt == chars_format::scientific, &number);
+    if (end == nullptr) {
+        return { first, std::errc::invalid_argument };
+    }
+
+    // The largest magnitude for the sign
+    const std::uint64_t max = negative ? detail::magnitude(std::numeric_limits<B>::min()) : static_cast<std::uint64_t>(std::numeric_limits<B>::max());
+
+    std::uint64_t magnitude;
+    const bool valid = hex ? detail::hex_to_magnitude<F, R>(number, max, &magnitude)
+                           : detail::decimal_to_magnitude<F, R>(number, max, &magnitude);
+    if (!valid) {
+        return { end, std::errc::result_out_of_range };
+    }
+    value = fixed<B, I, F, R>::from_raw_value(static_cast<B>(negative ? 0 - magnitude : magnitude));
+    return { end, std::errc{} };
+}
+
+}
+
+#endif
@@ -0,0 +1,379 @@
+#ifndef FPM_COMPRESS_HPP
+#define FPM_COMPRESS_HPP
+
+#include "fixed.hpp"
+#include "math.hpp"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <vector>
+
+namespace fpm
+{
+
+//! Lossless compression of series of fixed-point numbers.
+//! The values are compressed in independent blocks of up to 128 values. Every block stores its first value,
+//! and the differences between consecutive values (deltas) or between consecutive deltas, whichever is smaller.
+//! These are zig-zag encoded, so small negative differences become small numbers, and packed with the
+//! number of bits of the largest one:
+//!
+//!   size  content
+//!      1  the number of values minus one
+//!      1  the number of bits per difference, plus 128 if they are differences of deltas
+//!    1-10 the first value, zig-zag encoded, as a little-endian base-128 varint
+//!    1-10 for differences of deltas, the first delta, zig-zag encoded, as a varint
+//!         the remaining differences, packed into little-endian bytes
+//!
+//! Compressed data doesn't record the type of its values, so it must be decompressed into the same type.
+//! Since blocks are independent, compressed data can be concatenated.
+
+namespace detail
+{
+
+constexpr std::size_t compress_block_size = 128;
+
+inline std::uint64_t value_mask(unsigned int bits) noexcept
+{
+    return (bits >= 64) ? ~std::uint64_t{0} : (std::uint64_t{1} << bits) - 1;
+}
+
+// Maps a `Bits`-bit two's-complement number to an unsigned number: 0, -1, 1, -2, ... become 0, 1, 2, 3, ...
+template <unsigned int Bits>
+std::uint64_t zigzag(std::uint64_t value) noexcept
+{
+    const std::uint64_t sign = (value >> (Bits - 1)) & 1;
+    return ((value << 1) ^ (0 - sign)) & value_mask(Bits);
+}
+
+template <unsigned int Bits>
+std::uint64_t unzigzag(std::uint64_t value) noexcept
+{
+    return ((value >> 1) ^ (0 - (value & 1))) & value_mask(Bits);
+}
+
+// The number of bits to store a value
+inline unsigned int bit_width(std::uint64_t value) noexcept
+{
+    return (value == 0) ? 0 : static_cast<unsigned int>(find_highest_bit(value)) + 1;
+}
+
+inline unsigned int varint_size(std::uint64_t value) noexcept
+{
+    return (bit_width(value) + 6) / 7 + (value == 0 ? 1 : 0);
+}
+
+inline unsigned char* write_varint(unsigned char* out, std::uint64_t value) noexcept
+{
+    for (; value >= 0x80; value >>= 7) {
+        *out++ = static_cast<unsigned char>(value | 0x80);
+    }
+    *out++ = static_cast<unsigned char>(value);
+    return out;
+}
+
+// Reads a varint from [first, last). Returns nullptr if it's truncated or too long.
+inline const unsigned char* read_varint(const unsigned char* first, const unsigned char* last, std::uint64_t& value) noexcept
+{
+    value = 0;
+    for (unsigned int shift = 0; first != last && shift < 64; shift += 7) {
+        const unsigned char byte = *first++;
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return first;
+        }
+    }
+    return nullptr;
+}
+
+// Loads eight bytes as a little-endian number
+inline std::uint64_t load_le64(const unsigned char* bytes) noexcept
+{
+    std::uint64_t value = 0;
+    for (int i = 7; i >= 0; --i) {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+inline void store_le64(unsigned char* bytes, std::uint64_t value) noexcept
+{
+    for (int i = 0; i < 8; ++i) {
+        bytes[i] = static_cast<unsigned char>(value >> (i * 8));
+    }
+}
+
+// Packs `count` values of `bits` bits each into `out`, which must have room for eight bytes more
+// than the packed size. Returns the end of the packed values.
+inline unsigned char* pack_bits(unsigned char* out, const std::uint64_t* values, std::size_t count, unsigned int bits) noexcept
+{
+    if (bits == 0) {
+        return out;
+    }
+    std::uint64_t buffer = 0;
+    unsigned int used = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        buffer |= values[i] << used;
+        used += bits;
+        if (used >= 64) {
+            store_le64(out, buffer);
+            out += 8;
+            used -= 64;
+            buffer = (used > 0) ? values[i] >> (bits - used) : 0;
+        }
+    }
+    store_le64(out, buffer);
+    return out + (used + 7) / 8;
+}
+
+// Unpacks `count` values of `bits` bits each from `in`, which must have nine readable bytes
+// after the start of the last value.
+inline void unpack_bits(const unsigned char* in, std::uint64_t* values, std::size_t count, unsigned int bits) noexcept
+{
+    if (bits == 0) {
+        std::memset(values, 0, count * sizeof(std::uint64_t));
+        return;
+    }
+    const std::uint64_t mask = value_mask(bits);
+    std::size_t position = 0;
+    if (bits <= 56) {
+        // Every value is within the eight bytes at its first byte
+        for (std::size_t i = 0; i < count; ++i, position += bits) {
+            values[i] = (load_le64(in + position / 8) >> (position % 8)) & mask;
+        }
+        return;
+    }
+    for (std::size_t i = 0; i < count; ++i, position += bits) {
+        const unsigned char* const bytes = in + position / 8;
+        const unsigned int shift = position % 8;
+        std::uint64_t value = load_le64(bytes) >> shift;
+        if (shift + bits > 64) {
+            value |= static_cast<std::uint64_t>(bytes[8]) << (64 - shift);
+        }
+        values[i] = value & mask;
+    }
+}
+
+// Appends a block of 1 to compress_block_size raw values, each masked to `Bits` bits
+template <unsigned int Bits>
+void compress_block(const std::uint64_t* raw, std::size_t count, std::vector<unsigned char>& data)
+{
+    assert(count > 0 && count <= compress_block_size);
+    constexpr std::uint64_t mask = (Bits >= 64) ? ~std::uint64_t{0} : (std::uint64_t{1} << (Bits % 64)) - 1;
+
+    // The deltas, and the differences between consecutive deltas
+    std::uint64_t deltas[compress_block_size];
+    std::uint64_t delta_deltas[compress_block_size];
+    std::uint64_t delta_bits = 0, delta_delta_bits = 0;
+    std::uint64_t previous = 0;
+    for (std::size_t i = 1; i < count; ++i) {
+        const std::uint64_t delta = (raw[i] - raw[i - 1]) & mask;
+        deltas[i] = zigzag<Bits>(delta);
+        delta_bits |= deltas[i];
+        if (i >= 2) {
+            delta_deltas[i] = zigzag<Bits>((delta - previous) & mask);
+            delta_delta_bits |= delta_deltas[i];
+        }
+        previous = delta;
+    }
+
+    const unsigned int delta_width = bit_width(delta_bits);
+    const unsigned int delta_delta_width = bit_width(delta_delta_bits);
+    const bool use_delta_deltas = (count > 2) &&
+        varint_size(deltas[1]) * 8 + (count - 2) * delta_delta_width < (count - 1) * delta_width;
+
+    const std::uint64_t first_value = zigzag<Bits>(raw[0]);
+    const std::size_t packed_size = use_delta_deltas ? ((count - 2) * delta_delta_width + 7) / 8
+                                                     : ((count - 1) * delta_width + 7) / 8;
+    const std::size_t size = 2 + varint_size(first_value) + (use_delta_deltas ? varint_size(deltas[1]) : 0) + packed_size;
+
+    // Packing writes eight bytes at a time
+    const std::size_t offset = data.size();
+    data.resize(offset + size + 8);
+    unsigned char* out = &data[offset];
+    *out++ = static_cast<unsigned char>(count - 1);
+    *out++ = static_cast<unsigned char>(use_delta_deltas ? 128 + delta_delta_width : delta_width);
+    out = write_varint(out, first_value);
+    if (use_delta_deltas) {
+        out = write_varint(out, deltas[1]);
+        out = pack_bits(out, delta_deltas + 2, count - 2, delta_delta_width);
+    } else if (count > 1) {
+        out = pack_bits(out, deltas + 1, count - 1, delta_width);
+    }
+    assert(out == &data[offset + size]);
+    (void)out;
+    data.resize(offset + size);
+}
+
+// Decompresses the block at `first` into `raw`, and sets `count` to its number of values.
+// Returns the end of the block, or nullptr if it's not valid.
+template <unsigned int Bits>
+const unsigned char* decompress_block(const unsigned char* first, const unsigned char* last,
+                                      std::uint64_t* raw, std::size_t& count) noexcept
+{
+    constexpr std::uint64_t mask = (Bits >= 64) ? ~std::uint64_t{0} : (std::uint64_t{1} << (Bits % 64)) - 1;
+
+    if (last - first < 2) {
+        return nullptr;
+    }
+    count = std::size_t{first[0]} + 1;
+    const bool use_delta_deltas = (first[1] & 128) != 0;
+    const unsigned int width = first[1] & 127;
+    if (count > compress_block_size || width > Bits || (use_delta_deltas && count <= 2)) {
+        return nullptr;
+    }
+
+    std::uint64_t value, delta = 0;
+    first = read_varint(first + 2, last, value);
+    if (first == nullptr) {
+        return nullptr;
+    }
+    if (use_delta_deltas) {
+        first = read_varint(first, last, delta);
+        if (first == nullptr) {
+            return nullptr;
+        }
+        delta = unzigzag<Bits>(delta);
+    }
+
+    const std::size_t packed_count = use_delta_deltas ? count - 2 : count - 1;
+    const std::size_t packed_size = (packed_count * width + 7) / 8;
+    if (static_cast<std::size_t>(last - first) < packed_size) {
+        return nullptr;
+    }
+
+    // Unpacking reads up to nine bytes at a time, so copy the last block of the data
+    unsigned char buffer[compress_block_size * 8 + 16];
+    const unsigned char* packed = first;
+    if (static_cast<std::size_t>(last - first) < packed_size + 9) {
+        std::memcpy(buffer, first, packed_size);
+        std::memset(buffer + packed_size, 0, 16);
+        packed = buffer;
+    }
+    std::uint64_t residuals[compress_block_size];
+    unpack_bits(packed, residuals, packed_count, width);
+
+    raw[0] = unzigzag<Bits>(value);
+    if (use_delta_deltas) {
+        raw[1] = (raw[0] + delta) & mask;
+        for (std::size_t i = 2; i < count; ++i) {
+            delta += unzigzag<Bits>(residuals[i - 2]);
+            raw[i] = (raw[i - 1] + delta) & mask;
+        }
+    } else {
+        for (std::size_t i = 1; i < count; ++i) {
+            raw[i] = (raw[i - 1] + unzigzag<Bits>(residuals[i - 1])) & mask;
+        }
+    }
+    return first + packed_size;
+}
+
+}
+
+//! Compresses a series of fixed-point numbers as it's appended to.
+//! Values are compressed per block of 128 values; flush() compresses the remaining values as a smaller block.
+//! \tparam Fixed the fixed-point type of the values
+template <typename Fixed>
+class compressor;
+
+template <typename B, typename I, unsigned int F, bool R>
+class compressor<fixed<B, I, F, R>>
+{
+    static_assert(sizeof(B) <= 8, "BaseType must not be larger than 64 bits");
+    static constexpr unsigned int Bits = sizeof(B) * 8;
+
+public:
+    // Appends the compressed data to `data`
+    explicit compressor(std::vector<unsigned char>& data) noexcept
+        : m_data(data)
+    {}
+
+    compressor(const compressor&) = delete;
+    compressor& operator=(const compressor&) = delete;
+
+    ~compressor()
+    {
+        flush();
+    }
+
+    void append(fixed<B, I, F, R> value)
+    {
+        m_raw[m_count++] = static_cast<std::uint64_t>(value.raw_value()) & detail::value_mask(Bits);
+        if (m_count == detail::compress_block_size) {
+            flush();
+        }
+    }
+
+    void append(const fixed<B, I, F, R>* values, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            append(values[i]);
+        }
+    }
+
+    // Compresses the values that don't fill a block yet
+    void flush()
+    {
+        if (m_count > 0) {
+            detail::compress_block<Bits>(m_raw, m_count, m_data);
+            m_count = 0;
+        }
+    }
+
+private:
+    std::vector<unsigned char>& m_data;
+    std::uint64_t m_raw[detail::compress_block_size];
+    std::size_t m_count = 0;
+};
+
+// Appends the compressed values to `data`
+template <typename B, typename I, unsigned int F, bool R>
+void compress(const fixed<B, I, F, R>* values, std::size_t count, std::vector<unsigned char>& data)
+{
+    compressor<fixed<B, I, F, R>> compressor(data);
+    compressor.append(values, count);
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+std::vector<unsigned char> compress(const std::vector<fixed<B, I, F, R>>& values)
+{
+    std::vector<unsigned char> data;
+    compress(values.data(), values.size(), data);
+    return data;
+}
+
+// Appends the values that were compressed into [first, last) to `values`.
+// Returns std::errc{} on success, or illegal_byte_sequence if the data isn't valid.
+// In that case, the values of the blocks before the invalid one have been appended.
+template <typename B, typename I, unsigned int F, bool R>
+std::errc decompress(const unsigned char* first, const unsigned char* last, std::vector<fixed<B, I, F, R>>& values)
+{
+    static_assert(sizeof(B) <= 8, "BaseType must not be larger than 64 bits");
+    constexpr unsigned int Bits = sizeof(B) * 8;
+
+    std::uint64_t raw[detail::compress_block_size];
+    while (first != last) {
+        std::size_t count;
+        first = detail::decompress_block<Bits>(first, last, raw, count);
+        if (first == nullptr) {
+            return std::errc::illegal_byte_sequence;
+        }
+        const std::size_t offset = values.size();
+        values.resize(offset + count);
+        for (std::size_t i = 0; i < count; ++i) {
+            values[offset + i] = fixed<B, I, F, R>::from_raw_value(static_cast<B>(raw[i]));
+        }
+    }
+    return std::errc{};
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+std::errc decompress(const std::vector<unsigned char>& data, std::vector<fixed<B, I, F, R>>& values)
+{
+    return decompress(data.data(), data.data() + data.size(), values);
+}
+
+}
+
+#endif
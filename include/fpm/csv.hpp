@@ -0,0 +1,526 @@
+#ifndef FPM_CSV_HPP
+#define FPM_CSV_HPP
+
+#include "charconv.hpp"
+#include "fixed.hpp"
+#include "mapped_file.hpp"
+#include <cassert>
+#include <climits>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace fpm
+{
+
+// Options for reading CSV files
+struct csv_options
+{
+    // The character between fields. Fields can't be quoted, so they can't contain it.
+    char delimiter = ',';
+
+    // Whether the first line holds the names of the columns
+    bool header = true;
+
+    // The indices of the columns to read, in the order to store them. If empty, all columns are read.
+    std::vector<std::size_t> columns;
+
+    // The number of threads to parse with. If zero, the number of hardware threads is used.
+    // Every thread parses at least 64 KiB.
+    unsigned int threads = 0;
+};
+
+// A field that couldn't be parsed. Its value is zero.
+struct csv_error
+{
+    std::size_t row;     // the row, not counting the header
+    std::size_t column;  // the column in the file
+    std::errc ec;        // invalid_argument if missing or not a number, result_out_of_range if out of range
+};
+
+// The columns of a CSV file as contiguous arrays
+template <typename Fixed>
+struct csv_table
+{
+    std::size_t rows = 0;
+    std::vector<std::string> names;           // the names of the columns, if the file has a header
+    std::vector<std::vector<Fixed>> columns;  // the values of every column that was read
+    std::vector<csv_error> errors;            // the fields that couldn't be parsed, ordered by row
+};
+
+namespace detail
+{
+
+// Returns the position of the line break that ends the line at `first`, or `last`
+inline const char* find_line_end(const char* first, const char* last) noexcept
+{
+    const void* end = std::memchr(first, '\n', static_cast<std::size_t>(last - first));
+    return (end != nullptr) ? static_cast<const char*>(end) : last;
+}
+
+// Returns the start of the next line
+inline const char* next_line(const char* first, const char* last) noexcept
+{
+    const char* end = find_line_end(first, last);
+    return (end != last) ? end + 1 : last;
+}
+
+// Counts the rows in [first, last): every line, including a last line without line break
+inline std::size_t count_rows(const char* first, const char* last) noexcept
+{
+    std::size_t rows = 0;
+    for (; first != last; first = next_line(first, last)) {
+        ++rows;
+    }
+    return rows;
+}
+
+// Calls `on_field` with the index, start and end of every field in the line [first, last),
+// without surrounding spaces or a carriage return, until it returns false.
+template <typename OnField>
+void split_fields(const char* first, const char* last, char delimiter, OnField on_field)
+{
+    if (first != last && *(last - 1) == '\r') {
+        --last;
+    }
+    for (std::size_t index = 0;; ++index) {
+        const void* found = std::memchr(first, delimiter, static_cast<std::size_t>(last - first));
+        const char* end = (found != nullptr) ? static_cast<const char*>(found) : last;
+
+        const char* field_first = first;
+        const char* field_last = end;
+        while (field_first != field_last && (*field_first == ' ' || *field_first == '\t')) {
+            ++field_first;
+        }
+        while (field_last != field_first && (*(field_last - 1) == ' ' || *(field_last - 1) == '\t')) {
+            --field_last;
+        }
+        if (!on_field(index, field_first, field_last) || end == last) {
+            return;
+        }
+        first = end + 1;
+    }
+}
+
+// Parses the rows in [first, last), starting at row `row`, into the columns.
+// `targets` maps every column in the file to its index in `columns`, or -1 if it isn't read.
+template <typename Fixed>
+void parse_csv_rows(const char* first, const char* last, std::size_t row, char delimiter,
+                    const std::vector<std::ptrdiff_t>& targets, std::vector<std::vector<Fixed>>& columns,
+                    std::vector<csv_error>& errors)
+{
+    for (; first != last; ++row) {
+        const char* const end = find_line_end(first, last);
+
+        // The number of fields in the row, up to the last column that is read
+        std::size_t fields = 0;
+        split_fields(first, end, delimiter, [&](std::size_t index, const char* field_first, const char* field_last) {
+            if (index >= targets.size()) {
+                return false;
+            }
+            fields = index + 1;
+            const auto target = targets[index];
+            if (target >= 0) {
+                auto& value = columns[static_cast<std::size_t>(target)][row];
+                auto result = from_chars(field_first, field_last, value);
+                if (result.ec == std::errc{} && result.ptr != field_last) {
+                    result.ec = std::errc::invalid_argument;
+                }
+                if (result.ec != std::errc{}) {
+                    value = Fixed(0);
+                    errors.push_back(csv_error{ row, index, result.ec });
+                }
+            }
+            return true;
+        });
+
+        // Report the missing fields
+        for (std::size_t index = fields; index < targets.size(); ++index) {
+            const auto target = targets[index];
+            if (target >= 0) {
+                columns[static_cast<std::size_t>(target)][row] = Fixed(0);
+                errors.push_back(csv_error{ row, index, std::errc::invalid_argument });
+            }
+        }
+        first = (end != last) ? end + 1 : last;
+    }
+}
+
+}
+
+// Reads the columns of CSV data in [first, last) into the table. Every field that is read must be
+// a decimal number in the syntax of from_chars, optionally surrounded by spaces. The rows are split
+// into chunks at line boundaries, which are parsed in parallel.
+// Fields that can't be parsed are reported in the table's errors; parsing continues with the next field.
+template <typename B, typename I, unsigned int F, bool R>
+void read_csv(const char* first, const char* last, csv_table<fixed<B, I, F, R>>& table, const csv_options& options = csv_options())
+{
+    using Fixed = fixed<B, I, F, R>;
+    table = csv_table<Fixed>();
+    if (first == last) {
+        return;
+    }
+
+    // Determine the columns from the header or the first row
+    const char* const header_end = detail::find_line_end(first, last);
+    std::vector<std::string> header;
+    detail::split_fields(first, header_end, options.delimiter, [&](std::size_t, const char* field_first, const char* field_last) {
+        header.emplace_back(field_first, field_last);
+        return true;
+    });
+    const std::size_t file_columns = header.size();
+    if (options.header) {
+        first = detail::next_line(first, last);
+    }
+
+    std::vector<std::size_t> selected = options.columns;
+    if (selected.empty()) {
+        for (std::size_t index = 0; index < file_columns; ++index) {
+            selected.push_back(index);
+        }
+    }
+    std::vector<std::ptrdiff_t> targets;
+    for (std::size_t target = 0; target < selected.size(); ++target) {
+        if (selected[target] >= targets.size()) {
+            targets.resize(selected[target] + 1, -1);
+        }
+        targets[selected[target]] = static_cast<std::ptrdiff_t>(target);
+        if (options.header) {
+            table.names.push_back(selected[target] < header.size() ? header[selected[target]] : std::string());
+        }
+    }
+
+    // Split the data into chunks of whole lines, one per thread
+    constexpr std::size_t MinChunkSize = 64 * 1024;
+    const std::size_t size = static_cast<std::size_t>(last - first);
+    std::size_t threads = (options.threads > 0) ? options.threads : std::thread::hardware_concurrency();
+    if (threads > size / MinChunkSize) {
+        threads = size / MinChunkSize;
+    }
+    if (threads == 0) {
+        threads = 1;
+    }
+
+    std::vector<const char*> bounds(1, first);
+    for (std::size_t chunk = 1; chunk < threads; ++chunk) {
+        const char* bound = first + size / threads * chunk;
+        bound = (bound > bounds.back()) ? detail::next_line(bound, last) : bounds.back();
+        bounds.push_back(bound);
+    }
+    bounds.push_back(last);
+
+    // Count the rows of every chunk, so every chunk knows where to store its rows
+    std::vector<std::size_t> rows(threads + 1, 0);
+    {
+        std::vector<std::thread> workers;
+        for (std::size_t chunk = 1; chunk < threads; ++chunk) {
+            workers.emplace_back([&rows, &bounds, chunk] {
+                rows[chunk + 1] = detail::count_rows(bounds[chunk], bounds[chunk + 1]);
+            });
+        }
+        rows[1] = detail::count_rows(bounds[0], bounds[1]);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+    for (std::size_t chunk = 1; chunk <= threads; ++chunk) {
+        rows[chunk] += rows[chunk - 1];
+    }
+    table.rows = rows[threads];
+    table.columns.assign(selected.size(), std::vector<Fixed>(table.rows));
+
+    // Parse every chunk into its rows
+    std::vector<std::vector<csv_error>> errors(threads);
+    {
+        std::vector<std::thread> workers;
+        const auto parse = [&](std::size_t chunk) {
+            detail::parse_csv_rows(bounds[chunk], bounds[chunk + 1], rows[chunk], options.delimiter, targets, table.columns, errors[chunk]);
+        };
+        for (std::size_t chunk = 1; chunk < threads; ++chunk) {
+            workers.emplace_back(parse, chunk);
+        }
+        parse(0);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+    for (auto& chunk_errors : errors) {
+        table.errors.insert(table.errors.end(), chunk_errors.begin(), chunk_errors.end());
+    }
+}
+
+// Reads the columns of a memory-mapped CSV file into the table, like read_csv.
+// Returns std::errc{} on success, or the reason the file couldn't be mapped.
+template <typename B, typename I, unsigned int F, bool R>
+std::errc read_csv_file(const char* path, csv_table<fixed<B, I, F, R>>& table, const csv_options& options = csv_options())
+{
+    detail::mapped_file file;
+    const auto ec = file.open(path);
+    if (ec == std::errc{}) {
+        read_csv(file.data(), file.data() + file.size(), table, options);
+    }
+    return ec;
+}
+
+namespace detail
+{
+
+// A growing character buffer to format CSV output in
+class csv_buffer
+{
+public:
+    // Returns the position of at least `count` free characters after the content
+    char* reserve(std::size_t count)
+    {
+        if (m_data.size() - m_size < count) {
+            m_data.resize(m_size + count + m_data.size());
+        }
+        return &m_data[m_size];
+    }
+
+    // Appends the characters up to `end`, which were written to the reserved characters
+    void commit(const char* end) noexcept
+    {
+        m_size = static_cast<std::size_t>(end - m_data.data());
+    }
+
+    void append(char ch)
+    {
+        *reserve(1) = ch;
+        ++m_size;
+    }
+
+    void append(const char* first, std::size_t count)
+    {
+        std::memcpy(reserve(count), first, count);
+        m_size += count;
+    }
+
+    const char* data() const noexcept { return m_data.data(); }
+    std::size_t size() const noexcept { return m_size; }
+    void clear() noexcept { m_size = 0; }
+
+private:
+    std::vector<char> m_data;
+    std::size_t m_size = 0;
+};
+
+// Appends a number in fixed notation with `precision` decimals, or if negative, with the
+// fewest decimals that read back to the same value
+template <typename B, typename I, unsigned int F, bool R>
+void append_field(csv_buffer& buffer, fixed<B, I, F, R> value, int precision)
+{
+    // The sign, integral digits and decimal point, and the decimals
+    const std::size_t size = 24 + ((precision < 0) ? F : static_cast<std::size_t>(precision));
+    char* const first = buffer.reserve(size);
+    const auto result = (precision < 0) ? to_chars(first, first + size, value, chars_format::fixed)
+                                        : to_chars(first, first + size, value, chars_format::fixed, precision);
+    assert(result.ec == std::errc{});
+    buffer.commit(result.ptr);
+}
+
+// Appends a floating-point number like printf with %f and `precision`, or if negative, like %.17g
+inline void append_field(csv_buffer& buffer, double value, int precision)
+{
+    std::size_t size = 32;
+    for (;;) {
+        char* const first = buffer.reserve(size);
+        const int length = (precision < 0) ? std::snprintf(first, size, "%.17g", value)
+                                           : std::snprintf(first, size, "%.*f", precision, value);
+        if (length < 0) {
+            return;
+        }
+        if (static_cast<std::size_t>(length) < size) {
+            buffer.commit(first + length);
+            return;
+        }
+        size = static_cast<std::size_t>(length) + 1;
+    }
+}
+
+inline void append_field(csv_buffer& buffer, const char* text, int)
+{
+    buffer.append(text, std::strlen(text));
+}
+
+inline void append_field(csv_buffer& buffer, const std::string& text, int)
+{
+    buffer.append(text.data(), text.size());
+}
+
+// Appends the rows [first, last) of the columns
+// The precision of columns without a precision of their own, which use the default precision
+constexpr int unset_precision = INT_MIN;
+
+inline int column_precision(const std::vector<int>& precisions, std::size_t column, int default_precision) noexcept
+{
+    return (column < precisions.size() && precisions[column] != unset_precision) ? precisions[column] : default_precision;
+}
+
+template <typename Fixed>
+void append_rows(csv_buffer& buffer, const std::vector<std::vector<Fixed>>& columns, std::size_t first, std::size_t last,
+                 const std::vector<int>& precisions, int default_precision, char delimiter)
+{
+    for (std::size_t row = first; row < last; ++row) {
+        for (std::size_t column = 0; column < columns.size(); ++column) {
+            if (column > 0) {
+                buffer.append(delimiter);
+            }
+            append_field(buffer, columns[column][row], column_precision(precisions, column, default_precision));
+        }
+        buffer.append('\n');
+    }
+}
+
+}
+
+// Writes CSV or TSV data to a stream. Rows are formatted into a buffer, which is passed to the
+// stream in large blocks, without the stream's formatting and locale.
+// Fields can be fixed-point numbers, doubles or text. Text isn't quoted.
+class csv_writer
+{
+public:
+    explicit csv_writer(std::ostream& os, char delimiter = ',') noexcept
+        : m_stream(os), m_delimiter(delimiter)
+    {}
+
+    csv_writer(const csv_writer&) = delete;
+    csv_writer& operator=(const csv_writer&) = delete;
+
+    ~csv_writer()
+    {
+        // A failure sets the stream's state, which throws if its exceptions are enabled
+        try {
+            flush();
+        } catch (const std::ios_base::failure&) {
+        }
+    }
+
+    // Sets the number of decimals of numbers in all columns without a precision of their own.
+    // If negative, the default, numbers are written with the fewest decimals that read back to the same value
+    // (or for doubles, like %.17g).
+    void precision(int precision) noexcept
+    {
+        m_default_precision = precision;
+    }
+
+    // Sets the number of decimals of numbers in a column
+    void precision(std::size_t column, int precision)
+    {
+        if (column >= m_precisions.size()) {
+            m_precisions.resize(column + 1, detail::unset_precision);
+        }
+        m_precisions[column] = precision;
+    }
+
+    // Writes a row with one field per argument
+    template <typename... Fields>
+    void write_row(const Fields&... fields)
+    {
+        std::size_t column = 0;
+        const int expand[] = { (append(column++, fields), 0)... };
+        (void)expand;
+        m_buffer.append('\n');
+        if (m_buffer.size() >= FlushSize) {
+            flush();
+        }
+    }
+
+    // Writes the columns as rows, formatting batches of rows in parallel.
+    // All columns must have the same size. If `threads` is zero, the number of hardware threads is used.
+    template <typename B, typename I, unsigned int F, bool R>
+    void write_columns(const std::vector<std::vector<fixed<B, I, F, R>>>& columns, unsigned int threads = 0)
+    {
+        const std::size_t rows = columns.empty() ? 0 : columns[0].size();
+        for (const auto& column : columns) {
+            assert(column.size() == rows);
+            (void)column;
+        }
+
+        std::size_t workers = (threads > 0) ? threads : std::thread::hardware_concurrency();
+        if (workers > rows / BatchRows) {
+            workers = rows / BatchRows;
+        }
+        if (workers <= 1) {
+            for (std::size_t row = 0; row < rows; row += BatchRows) {
+                const std::size_t last = (rows - row < BatchRows) ? rows : row + BatchRows;
+                detail::append_rows(m_buffer, columns, row, last, m_precisions, m_default_precision, m_delimiter);
+                flush();
+            }
+            return;
+        }
+
+        // Every worker formats a batch of rows into its own buffer, which are then written in order
+        flush();
+        std::vector<detail::csv_buffer> buffers(workers);
+        for (std::size_t row = 0; row < rows; row += workers * BatchRows) {
+            const auto format = [&](std::size_t worker) {
+                const std::size_t first = row + worker * BatchRows;
+                const std::size_t last = (rows - first < BatchRows) ? rows : first + BatchRows;
+                buffers[worker].clear();
+                if (first < rows) {
+                    detail::append_rows(buffers[worker], columns, first, last, m_precisions, m_default_precision, m_delimiter);
+                }
+            };
+
+            std::vector<std::thread> batch;
+            for (std::size_t worker = 1; worker < workers; ++worker) {
+                batch.emplace_back(format, worker);
+            }
+            format(0);
+            for (auto& thread : batch) {
+                thread.join();
+            }
+            for (const auto& buffer : buffers) {
+                write(buffer.data(), buffer.size());
+            }
+        }
+    }
+
+    // Passes the buffered rows to the stream.
+    // If the stream can't take all of them, or has no stream buffer, this sets its badbit.
+    void flush()
+    {
+        write(m_buffer.data(), m_buffer.size());
+        m_buffer.clear();
+    }
+
+private:
+    static constexpr std::size_t FlushSize = 64 * 1024;
+    static constexpr std::size_t BatchRows = 16 * 1024;
+
+    void write(const char* data, std::size_t size)
+    {
+        if (size == 0) {
+            return;
+        }
+        std::streambuf* const buffer = m_stream.rdbuf();
+        if (buffer == nullptr || buffer->sputn(data, static_cast<std::streamsize>(size)) != static_cast<std::streamsize>(size)) {
+            m_stream.setstate(std::ios::badbit);
+        }
+    }
+
+    template <typename Field>
+    void append(std::size_t column, const Field& field)
+    {
+        if (column > 0) {
+            m_buffer.append(m_delimiter);
+        }
+        detail::append_field(m_buffer, field, detail::column_precision(m_precisions, column, m_default_precision));
+    }
+
+    std::ostream& m_stream;
+    char m_delimiter;
+    int m_default_precision = -1;
+    std::vector<int> m_precisions;
+    detail::csv_buffer m_buffer;
+};
+
+}
+
+#endif
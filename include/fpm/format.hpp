@@ -0,0 +1,361 @@
+#ifndef FPM_FORMAT_HPP
+#define FPM_FORMAT_HPP
+
+#include "charconv.hpp"
+#include "fixed.hpp"
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <locale>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+// Parsing format specifications is constexpr where the language allows it,
+// so std::format can check format strings at compile time.
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201304L
+#define FPM_CONSTEXPR14 constexpr
+#else
+#define FPM_CONSTEXPR14
+#endif
+
+namespace fpm
+{
+namespace detail
+{
+
+// A standard format specification for fixed-point numbers, as for floating-point numbers:
+// [[fill]align][sign]['0'][width]['.' precision]['L'][type]
+// The width and precision must be numbers; nested replacement fields aren't supported.
+template <typename CharT>
+class format_spec
+{
+public:
+    // Parses the specification in [it, end) up to the closing brace, and sets `it` to it.
+    // Returns nullptr on success, or a description of the error.
+    template <typename Iterator>
+    FPM_CONSTEXPR14 const char* parse(Iterator& it, Iterator end)
+    {
+        if (it == end || *it == '}') {
+            return nullptr;
+        }
+
+        // The fill is a single character, which for char is a UTF-8 sequence of up to four code units
+        int fill_size = 1;
+        if (sizeof(CharT) == 1) {
+            const auto lead = static_cast<unsigned char>(*it);
+            fill_size = (lead < 0x80) ? 1 : (lead < 0xE0) ? 2 : (lead < 0xF0) ? 3 : 4;
+        }
+        Iterator align_it = it;
+        for (int i = 0; i < fill_size && align_it != end; ++i) {
+            ++align_it;
+        }
+        if (align_it != end && is_align(*align_it)) {
+            if (*it == '{' || *it == '}') {
+                return "invalid fill character";
+            }
+            for (int i = 0; i < fill_size; ++i, ++it) {
+                m_fill[i] = *it;
+            }
+            m_fill_size = fill_size;
+            m_align = static_cast<char>(*it++);
+        } else if (is_align(*it)) {
+            m_align = static_cast<char>(*it++);
+        }
+
+        if (it != end && (*it == '+' || *it == '-' || *it == ' ')) {
+            m_sign = static_cast<char>(*it++);
+        }
+        if (it != end && *it == '#') {
+            return "the alternate form is not supported for fixed-point numbers";
+        }
+        if (it != end && *it == '0') {
+            m_zero_pad = true;
+            ++it;
+        }
+        if (it != end && *it >= '0' && *it <= '9') {
+            if (!parse_number(it, end, m_width)) {
+                return "the width is too large";
+            }
+        }
+        if (it != end && *it == '{') {
+            return "nested replacement fields are not supported for fixed-point numbers";
+        }
+        if (it != end && *it == '.') {
+            ++it;
+            if (it != end && *it == '{') {
+                return "nested replacement fields are not supported for fixed-point numbers";
+            }
+            if (it == end || *it < '0' || *it > '9') {
+                return "missing precision";
+            }
+            if (!parse_number(it, end, m_precision)) {
+                return "the precision is too large";
+            }
+        }
+        if (it != end && *it == 'L') {
+            m_localized = true;
+            ++it;
+        }
+        if (it != end && *it != '}') {
+            switch (*it) {
+            case 'a': case 'A': case 'e': case 'E': case 'f': case 'F': case 'g': case 'G':
+                m_type = static_cast<char>(*it++);
+                break;
+            default:
+                return "invalid type for a fixed-point number";
+            }
+        }
+        if (it != end && *it != '}') {
+            return "invalid format specification for a fixed-point number";
+        }
+        return nullptr;
+    }
+
+    // Writes the formatted number to `out`. `get_locale` is only called for localized formatting.
+    template <typename OutputIt, typename GetLocale, typename B, typename I, unsigned int F, bool R>
+    OutputIt format(OutputIt out, fixed<B, I, F, R> x, GetLocale get_locale) const
+    {
+        // Enough for the default precisions. Larger precisions are written to a larger buffer.
+        char buffer[128];
+        std::vector<char> large_buffer;
+        char* first = buffer;
+        auto result = convert(buffer, buffer + sizeof(buffer), x);
+        if (result.ec != std::errc{}) {
+            large_buffer.resize(static_cast<std::size_t>(m_precision) + 64);
+            first = large_buffer.data();
+            result = convert(first, first + large_buffer.size(), x);
+        }
+        char* const last = result.ptr;
+        if (m_type == 'A' || m_type == 'E' || m_type == 'F' || m_type == 'G') {
+            for (char* p = first; p != last; ++p) {
+                *p = (*p >= 'a' && *p <= 'z') ? static_cast<char>(*p - 'a' + 'A') : *p;
+            }
+        }
+
+        char sign = '\0';
+        if (*first == '-') {
+            sign = '-';
+            ++first;
+        } else if (m_sign == '+' || m_sign == ' ') {
+            sign = m_sign;
+        }
+
+        if (!m_localized) {
+            out = write_padding(out, sign, static_cast<std::size_t>(last - first), true);
+            for (const char* p = first; p != last; ++p) {
+                *out++ = static_cast<CharT>(*p);
+            }
+            return write_padding(out, sign, static_cast<std::size_t>(last - first), false);
+        }
+
+        // Insert the locale's digit group separators into the integral digits
+        const std::locale locale = get_locale();
+        const auto& numpunct = std::use_facet<std::numpunct<CharT>>(locale);
+        const bool hex = (m_type == 'a' || m_type == 'A');
+        const std::string grouping = hex ? std::string() : numpunct.grouping();
+        const CharT thousands_sep = numpunct.thousands_sep();
+        const CharT decimal_point = numpunct.decimal_point();
+
+        const char* integral_end = first;
+        while (integral_end != last && *integral_end >= '0' && *integral_end <= '9') {
+            ++integral_end;
+        }
+        CharT integral[2 * std::numeric_limits<std::uint64_t>::digits10 + 2];
+        const std::size_t integral_capacity = sizeof(integral) / sizeof(integral[0]);
+        std::size_t integral_start = integral_capacity;
+        std::size_t group = 0;
+        int group_digits = 0;
+        for (const char* p = integral_end; p != first; ) {
+            const char size = grouping.empty() ? CHAR_MAX : grouping[group];
+            if (size > 0 && size != CHAR_MAX && group_digits == size) {
+                integral[--integral_start] = thousands_sep;
+                group_digits = 0;
+                group += (group + 1 < grouping.size()) ? 1 : 0;
+            }
+            integral[--integral_start] = static_cast<CharT>(*--p);
+            ++group_digits;
+        }
+
+        const std::size_t size = (integral_capacity - integral_start) + static_cast<std::size_t>(last - integral_end);
+        out = write_padding(out, sign, size, true);
+        for (std::size_t i = integral_start; i < integral_capacity; ++i) {
+            *out++ = integral[i];
+        }
+        for (const char* p = integral_end; p != last; ++p) {
+            *out++ = (*p == '.') ? decimal_point : static_cast<CharT>(*p);
+        }
+        return write_padding(out, sign, size, false);
+    }
+
+private:
+    static FPM_CONSTEXPR14 bool is_align(CharT ch) noexcept
+    {
+        return ch == '<' || ch == '>' || ch == '^';
+    }
+
+    template <typename Iterator>
+    static FPM_CONSTEXPR14 bool parse_number(Iterator& it, Iterator end, int& value)
+    {
+        value = 0;
+        for (; it != end && *it >= '0' && *it <= '9'; ++it) {
+            if (value > (INT_MAX - 9) / 10) {
+                return false;
+            }
+            value = value * 10 + static_cast<int>(*it - '0');
+        }
+        return true;
+    }
+
+    template <typename B, typename I, unsigned int F, bool R>
+    to_chars_result convert(char* first, char* last, fixed<B, I, F, R> x) const noexcept
+    {
+        switch (m_type) {
+        case 'a': case 'A':
+            return to_chars(first, last, x, chars_format::hex, m_precision);
+        case 'e': case 'E':
+            return to_chars(first, last, x, chars_format::scientific, m_precision);
+        case 'f': case 'F':
+            return to_chars(first, last, x, chars_format::fixed, m_precision);
+        case 'g': case 'G':
+            return to_chars(first, last, x, chars_format::general, m_precision);
+        default:
+            // Like std::format for floating-point numbers: the shortest representation, or %g with a precision
+            return (m_precision < 0) ? to_chars(first, last, x) : to_chars(first, last, x, chars_format::general, m_precision);
+        }
+    }
+
+    // Writes the padding before the number and its sign, or after the number, to pad a number
+    // of `size` characters without sign to the width
+    template <typename OutputIt>
+    OutputIt write_padding(OutputIt out, char sign, std::size_t size, bool before) const
+    {
+        size += (sign != '\0') ? 1 : 0;
+        const std::size_t padding = (static_cast<std::size_t>(m_width) > size) ? static_cast<std::size_t>(m_width) - size : 0;
+        if (m_zero_pad && m_align == '\0') {
+            // Zeros go between the sign and the number
+            if (before) {
+                if (sign != '\0') {
+                    *out++ = static_cast<CharT>(sign);
+                }
+                for (std::size_t i = 0; i < padding; ++i) {
+                    *out++ = CharT('0');
+                }
+            }
+            return out;
+        }
+
+        const std::size_t left_padding = (m_align == '<') ? 0 : (m_align == '^') ? padding / 2 : padding;
+        if (before) {
+            out = write_fill(out, left_padding);
+            if (sign != '\0') {
+                *out++ = static_cast<CharT>(sign);
+            }
+            return out;
+        }
+        return write_fill(out, padding - left_padding);
+    }
+
+    template <typename OutputIt>
+    OutputIt write_fill(OutputIt out, std::size_t count) const
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            for (int j = 0; j < m_fill_size; ++j) {
+                *out++ = m_fill[j];
+            }
+        }
+        return out;
+    }
+
+    CharT m_fill[4] = { CharT(' '), CharT(), CharT(), CharT() };
+    int m_fill_size = 1;
+    char m_align = '\0';
+    char m_sign = '-';
+    bool m_zero_pad = false;
+    int m_width = 0;
+    int m_precision = -1;
+    bool m_localized = false;
+    char m_type = '\0';
+};
+
+}
+}
+
+#if defined(__cpp_lib_format)
+
+namespace std
+{
+
+// Formats fixed-point numbers with std::format, like floating-point numbers
+template <typename B, typename I, unsigned int F, bool R, typename CharT>
+struct formatter<fpm::fixed<B, I, F, R>, CharT>
+{
+    constexpr typename basic_format_parse_context<CharT>::iterator parse(basic_format_parse_context<CharT>& ctx)
+    {
+        auto it = ctx.begin();
+        const char* const error = m_spec.parse(it, ctx.end());
+        if (error != nullptr) {
+            throw format_error(error);
+        }
+        return it;
+    }
+
+    template <typename FormatContext>
+    typename FormatContext::iterator format(fpm::fixed<B, I, F, R> x, FormatContext& ctx) const
+    {
+        return m_spec.format(ctx.out(), x, [&ctx] { return ctx.locale(); });
+    }
+
+private:
+    fpm::detail::format_spec<CharT> m_spec;
+};
+
+}
+
+#endif
+
+#if defined(FMT_VERSION)
+
+namespace fmt
+{
+
+// Formats fixed-point numbers with {fmt}, if it's included before this header
+template <typename B, typename I, unsigned int F, bool R, typename CharT>
+struct formatter<fpm::fixed<B, I, F, R>, CharT>
+{
+    FPM_CONSTEXPR14 auto parse(basic_format_parse_context<CharT>& ctx) -> decltype(ctx.begin())
+    {
+        auto it = ctx.begin();
+        const char* const error = m_spec.parse(it, ctx.end());
+        if (error != nullptr) {
+            FMT_THROW(format_error(error));
+        }
+        return it;
+    }
+
+    template <typename FormatContext>
+    auto format(fpm::fixed<B, I, F, R> x, FormatContext& ctx) const -> decltype(ctx.out())
+    {
+        return m_spec.format(ctx.out(), x, [&ctx] { return ctx.locale().template get<std::locale>(); });
+    }
+
+private:
+    fpm::detail::format_spec<CharT> m_spec;
+};
+
+}
+
+#endif
+
+#endif
@@ -9,23 +9,154 @@
 #include <climits>
 #include <limits>
 #include <ios>
+#include <istream>
+#include <locale>
+#include <string>
 #include <vector>
 
 namespace fpm
 {
 
-template <typename CharT, typename B, typename I, unsigned int F, bool R>
-std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, fixed<B, I, F, R> x) noexcept
+namespace detail
+{
+
+// The decimal digits of 00 to 99
+inline const char* digit_pairs() noexcept
 {
-    const auto uppercase = ((os.flags() & std::ios_base::uppercase) != 0);
-    const auto showpoint = ((os.flags() & std::ios_base::showpoint) != 0);
-    const auto adjustfield = (os.flags() & std::ios_base::adjustfield);
-    const auto width = os.width();
-    const auto& ctype = std::use_facet<std::ctype<CharT>>(os.getloc());
-    const auto& numpunct = std::use_facet<std::numpunct<CharT>>(os.getloc());
-
-    auto floatfield = (os.flags() & std::ios_base::floatfield);
-    auto precision = os.precision();
+    static const char pairs[] =
+        "00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839"
+        "40414243444546474849" "50515253545556575859" "60616263646566676869" "70717273747576777879"
+        "80818283848586878889" "90919293949596979899";
+    return pairs;
+}
+
+// Writes the decimal digits of a non-negative value backwards, two at a time, ending before `last`.
+// Returns the position of the first digit.
+template <typename T>
+char* write_decimal_backwards(char* last, T value) noexcept
+{
+    assert(value >= 0);
+    const char* const pairs = digit_pairs();
+    for (; value >= 100; value /= 100) {
+        const auto pair = static_cast<int>(value % 100) * 2;
+        *--last = pairs[pair + 1];
+        *--last = pairs[pair];
+    }
+    if (value >= 10) {
+        const auto pair = static_cast<int>(value) * 2;
+        *--last = pairs[pair + 1];
+        *--last = pairs[pair];
+    } else {
+        *--last = static_cast<char>('0' + value);
+    }
+    return last;
+}
+
+// The stream state and locale properties that affect the formatting of a number
+template <typename CharT>
+struct format_options
+{
+    format_options(const std::locale& locale, std::ios_base::fmtflags flags, std::streamsize precision, std::streamsize width, CharT fill)
+        : flags(flags)
+        , precision(precision)
+        , width(width)
+        , fill(fill)
+        , ctype(&std::use_facet<std::ctype<CharT>>(locale))
+    {
+        const auto& numpunct = std::use_facet<std::numpunct<CharT>>(locale);
+        decimal_point = numpunct.decimal_point();
+        thousands_sep = numpunct.thousands_sep();
+        grouping = numpunct.grouping();
+    }
+
+    std::ios_base::fmtflags flags;
+    std::streamsize precision;
+    std::streamsize width;
+    CharT fill;
+    CharT decimal_point;
+    CharT thousands_sep;
+    std::string grouping;
+    const std::ctype<CharT>* ctype;
+};
+
+// Writes formatted output to a stream buffer
+template <typename CharT>
+class streambuf_sink
+{
+public:
+    explicit streambuf_sink(std::basic_streambuf<CharT>& streambuf) noexcept
+        : m_streambuf(streambuf)
+    {}
+
+    void put(const CharT* chars, std::streamsize count)
+    {
+        m_streambuf.sputn(chars, count);
+    }
+
+    // Writes character `ch` `count` times
+    void fill(CharT ch, std::streamsize count)
+    {
+        // Fill a buffer to output larger chunks
+        constexpr std::streamsize chunk_size = 64;
+        std::array<CharT, chunk_size> fill_buffer;
+        std::fill_n(fill_buffer.begin(), std::min(count, chunk_size), ch);
+
+        for (std::streamsize size, left = count; left > 0; left -= size) {
+            size = std::min(chunk_size, left);
+            m_streambuf.sputn(&fill_buffer[0], size);
+        }
+    }
+
+private:
+    std::basic_streambuf<CharT>& m_streambuf;
+};
+
+// Writes formatted output to an array, counting but discarding what doesn't fit
+template <typename CharT>
+class array_sink
+{
+public:
+    array_sink(CharT* first, std::size_t size) noexcept
+        : m_first(first), m_size(size), m_count(0)
+    {}
+
+    void put(const CharT* chars, std::streamsize count) noexcept
+    {
+        if (m_count < m_size) {
+            std::copy_n(chars, std::min(static_cast<std::size_t>(count), m_size - m_count), m_first + m_count);
+        }
+        m_count += static_cast<std::size_t>(count);
+    }
+
+    // Writes character `ch` `count` times
+    void fill(CharT ch, std::streamsize count) noexcept
+    {
+        if (m_count < m_size) {
+            std::fill_n(m_first + m_count, std::min(static_cast<std::size_t>(count), m_size - m_count), ch);
+        }
+        m_count += static_cast<std::size_t>(count);
+    }
+
+    std::size_t count() const noexcept { return m_count; }
+
+private:
+    CharT* m_first;
+    std::size_t m_size;
+    std::size_t m_count;
+};
+
+// Formats a number like a floating-point number with the specified options, and writes it to the sink
+template <typename CharT, typename Sink, typename B, typename I, unsigned int F, bool R>
+void format(Sink& sink, const format_options<CharT>& options, fixed<B, I, F, R> x)
+{
+    const auto uppercase = ((options.flags & std::ios_base::uppercase) != 0);
+    const auto showpoint = ((options.flags & std::ios_base::showpoint) != 0);
+    const auto adjustfield = (options.flags & std::ios_base::adjustfield);
+    const auto width = options.width;
+    const auto& ctype = *options.ctype;
+
+    auto floatfield = (options.flags & std::ios_base::floatfield);
+    auto precision = options.precision;
     auto show_trailing_zeros = true;
     auto use_significant_digits = false;
 
@@ -91,7 +222,7 @@ std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, fixed<B, I,
         value.raw = -value.raw;
         internal_pad = end;
     }
-    else if (os.flags() & std::ios_base::showpos)
+    else if (options.flags & std::ios_base::showpos)
     {
         *end++ = ctype.widen('+');
         internal_pad = end;
@@ -165,7 +296,14 @@ std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, fixed<B, I,
     // Are we already printing significant digits? (yes if we're not counting significant digits)
     bool significant_digits = !use_significant_digits;
 
-    // Print the integral part
+    // Append the characters in [first, last) to the output
+    const auto put_chars = [&](const char* first, const char* last) {
+        ctype.widen(first, last, &*end);
+        end += last - first;
+    };
+
+    // Print the integral part.
+    // The last digit printed so far is needed to round ties to even.
     int last_digit = 0;
     if (integral == 0) {
         *end++ = ctype.widen('0');
@@ -174,10 +312,16 @@ std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, fixed<B, I,
             // as significant digits.
             significant_digits = true;
         }
+    } else if (base == 10) {
+        // Write the digits backwards into a scratch buffer, so they need no reversing
+        char scratch[std::numeric_limits<I>::digits10 + 1];
+        last_digit = static_cast<int>(integral % 10);
+        put_chars(detail::write_decimal_backwards(scratch + sizeof(scratch), integral), scratch + sizeof(scratch));
+        significant_digits = true;
     } else {
+        last_digit = static_cast<int>(integral % base);
         while (integral > 0) {
-            last_digit = integral % base;
-            *end++ = ctype.widen(digits[last_digit]);
+            *end++ = ctype.widen(digits[integral % base]);
             integral /= base;
         }
         std::reverse(digits_start, end);
@@ -208,47 +352,74 @@ std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, fixed<B, I,
     if (precision > 0)
     {
         // Print the fractional part
-        *(point = end++) = numpunct.decimal_point();
+        *(point = end++) = options.decimal_point;
 
-        for (int i = 0; i < precision; ++i)
-        {
-            if (value.raw == 0)
-            {
-                // The rest of the digits are all zeros, mark them
-                // to be printed in this spot.
-                trailing_zeros_start = end;
-                trailing_zeros_count = precision - i;
-                break;
-            }
+        int i = 0;
 
-            // Shift the divisor if we can to avoid overflow on the value
-            if (value.divisor % base == 0) {
-                value.divisor /= base;
-            } else {
-                value.raw *= base;
-            }
-            assert(value.divisor > 0);
-            assert(value.raw >= 0);
-            last_digit = (value.raw / value.divisor) % base;
+        // Shift the divisor while we can to avoid overflow on the value.
+        // This happens in scientific notation, where the integral part is significant.
+        for (; i < precision && value.raw != 0 && value.divisor % base == 0; ++i)
+        {
+            assert(significant_digits);
+            value.divisor /= base;
+            last_digit = static_cast<int>(value.raw / value.divisor);
             value.raw %= value.divisor;
             *end++ = ctype.widen(digits[last_digit]);
+        }
+
+        if (i < precision && value.raw != 0)
+        {
+            // The divisor is now a power of two, so we can extract the digits by multiplying and shifting.
+            // If the value has room for it, we extract two decimal digits at a time.
+            const auto shift = static_cast<int>(detail::find_highest_bit(value.divisor));
+            const I mask = value.divisor - 1;
+            const bool pairs = (base == 10 && shift < std::numeric_limits<I>::digits - 7);
+            assert((value.divisor & mask) == 0);
+
+            while (i < precision && value.raw != 0)
+            {
+                assert(value.raw >= 0);
+                if (pairs && significant_digits && precision - i >= 2) {
+                    value.raw *= 100;
+                    const auto pair = static_cast<int>(value.raw >> shift) * 2;
+                    value.raw &= mask;
+                    put_chars(detail::digit_pairs() + pair, detail::digit_pairs() + pair + 2);
+                    last_digit = detail::digit_pairs()[pair + 1] - '0';
+                    i += 2;
+                    continue;
+                }
 
-            if (!significant_digits) {
-                // We're still finding the first significant digit
-                if (last_digit != 0) {
-                    // Found it
-                    significant_digits = true;
-                } else {
-                    // Not yet; increment number of digits to print
-                    ++precision;
+                value.raw *= base;
+                last_digit = static_cast<int>(value.raw >> shift);
+                value.raw &= mask;
+                *end++ = ctype.widen(digits[last_digit]);
+                ++i;
+
+                if (!significant_digits) {
+                    // We're still finding the first significant digit
+                    if (last_digit != 0) {
+                        // Found it
+                        significant_digits = true;
+                    } else {
+                        // Not yet; increment number of digits to print
+                        ++precision;
+                    }
                 }
             }
         }
+
+        if (i < precision)
+        {
+            // The rest of the digits are all zeros, mark them
+            // to be printed in this spot.
+            trailing_zeros_start = end;
+            trailing_zeros_count = precision - i;
+        }
     }
     else if (showpoint)
     {
         // No fractional part to print, but we still want the point
-        *(point = end++) = numpunct.decimal_point();
+        *(point = end++) = options.decimal_point;
     }
 
     // Insert `ch` into the output at `position`, updating all references accordingly
@@ -342,12 +513,12 @@ std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, fixed<B, I,
     }
 
     // Apply thousands grouping
-    const auto& grouping = numpunct.grouping();
+    const auto& grouping = options.grouping;
     if (!grouping.empty())
     {
         // Step backwards from the end or decimal point, inserting the
         // thousands separator at every group interval.
-        const CharT thousands_sep = ctype.widen(numpunct.thousands_sep());
+        const CharT thousands_sep = options.thousands_sep;
         std::size_t group = 0;
         auto p = point != buffer.end() ? point : end;
         auto size = static_cast<int>(grouping[group]);
@@ -385,29 +556,10 @@ std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, fixed<B, I,
             }
         }
 
-        const auto exponent_start = end;
-        if (value.exponent == 0) {
-            *end++ = ctype.widen('0');
-        } else while (value.exponent > 0) {
-            *end++ = ctype.widen(digits[value.exponent % 10]);
-            value.exponent /= 10;
-        }
-        std::reverse(exponent_start, end);
+        char scratch[std::numeric_limits<int>::digits10 + 1];
+        put_chars(detail::write_decimal_backwards(scratch + sizeof(scratch), value.exponent), scratch + sizeof(scratch));
     }
 
-    // Write character `ch` `count` times to the stream
-    const auto sputcn = [&](CharT ch, std::streamsize count){
-        // Fill a buffer to output larger chunks
-        constexpr std::streamsize chunk_size = 64;
-        std::array<CharT, chunk_size> fill_buffer;
-        std::fill_n(fill_buffer.begin(), std::min(count, chunk_size), ch);
-
-        for (std::streamsize size, left = count; left > 0; left -= size) {
-            size = std::min(chunk_size, left);
-            os.rdbuf()->sputn(&fill_buffer[0], size);
-        }
-    };
-
     // Outputs a range of characters, making sure to output the trailing zeros range
     // if it lies in the specified range
     const auto put_range = [&](typename buffer_t::const_iterator begin, typename buffer_t::const_iterator end) {
@@ -415,12 +567,12 @@ std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, fixed<B, I,
         if (trailing_zeros_start >= begin && trailing_zeros_start <= end) {
             // Print range with trailing zeros range in the middle
             assert(trailing_zeros_count > 0);
-            os.rdbuf()->sputn(&*begin, trailing_zeros_start - begin);
-            sputcn(ctype.widen('0'), trailing_zeros_count);
-            os.rdbuf()->sputn(&*trailing_zeros_start, end - trailing_zeros_start);
+            sink.put(&*begin, trailing_zeros_start - begin);
+            sink.fill(ctype.widen('0'), trailing_zeros_count);
+            sink.put(&*trailing_zeros_start, end - trailing_zeros_start);
         } else {
             // Print range as-is
-            os.rdbuf()->sputn(&*begin, end - begin);
+            sink.put(&*begin, end - begin);
         }
     };
 
@@ -440,22 +592,32 @@ std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, fixed<B, I,
         case std::ios_base::left:
             // Content is left-aligned, so output the buffer, followed by the padding
             put_range(buffer.begin(), end);
-            sputcn(os.fill(), pad_size);
+            sink.fill(options.fill, pad_size);
             break;
         case std::ios_base::internal:
             // Content is internally aligned, so output the buffer up to the "internal pad"
             // point, followed by the padding, followed by the remainder of the buffer.
             put_range(buffer.begin(), internal_pad);
-            sputcn(os.fill(), pad_size);
+            sink.fill(options.fill, pad_size);
             put_range(internal_pad, end);
             break;
         default:
             // Content is right-aligned, so output the padding, followed by the buffer
-            sputcn(os.fill(), pad_size);
+            sink.fill(options.fill, pad_size);
             put_range(buffer.begin(), end);
             break;
         }
     }
+}
+
+}
+
+template <typename CharT, typename B, typename I, unsigned int F, bool R>
+std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, fixed<B, I, F, R> x) noexcept
+{
+    const detail::format_options<CharT> options(os.getloc(), os.flags(), os.precision(), os.width(), os.fill());
+    detail::streambuf_sink<CharT> sink(*os.rdbuf());
+    detail::format(sink, options, x);
 
     // Width is reset after every write
     os.width(0);
@@ -463,6 +625,359 @@ std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, fixed<B, I,
     return os;
 }
 
+// Formats numbers like operator<<, with the formatting flags and locale captured once.
+// This avoids the locale lookups of operator<< when formatting many numbers.
+// Unlike that of a stream, the width applies to every number.
+template <typename CharT>
+class basic_formatter
+{
+public:
+    // Captures the flags, precision, width, fill character and locale of a stream
+    explicit basic_formatter(const std::basic_ios<CharT>& ios)
+        : m_locale(ios.getloc())
+        , m_options(m_locale, ios.flags(), ios.precision(), ios.width(), ios.fill())
+    {}
+
+    explicit basic_formatter(std::ios_base::fmtflags flags = std::ios_base::dec, std::streamsize precision = 6,
+                             std::streamsize width = 0, const std::locale& locale = std::locale())
+        : m_locale(locale)
+        , m_options(m_locale, flags, precision, width, std::use_facet<std::ctype<CharT>>(locale).widen(' '))
+    {}
+
+    // Writes the formatted number to the stream buffer
+    template <typename B, typename I, unsigned int F, bool R>
+    void format(std::basic_streambuf<CharT>& streambuf, fixed<B, I, F, R> x) const
+    {
+        detail::streambuf_sink<CharT> sink(streambuf);
+        detail::format(sink, m_options, x);
+    }
+
+    // Writes the formatted number to [first, first + size), without a terminating null character.
+    // Like snprintf, returns the length of the entire output; if that exceeds `size`, the output was truncated.
+    template <typename B, typename I, unsigned int F, bool R>
+    std::size_t format(CharT* first, std::size_t size, fixed<B, I, F, R> x) const noexcept
+    {
+        detail::array_sink<CharT> sink(first, size);
+        detail::format(sink, m_options, x);
+        return sink.count();
+    }
+
+private:
+    // Keeps the facets alive
+    std::locale m_locale;
+    detail::format_options<CharT> m_options;
+};
+
+using formatter = basic_formatter<char>;
+using wformatter = basic_formatter<wchar_t>;
+
+
+namespace detail
+{
+
+// Combines eight decimal digits, one per byte with the first digit in the lowest byte, into their value.
+// The digits may be values or characters, since only the lower four bits of every byte are used.
+inline std::uint32_t combine_eight_digits(std::uint64_t value) noexcept
+{
+    value = ((value & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+    value = ((value & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+    return static_cast<std::uint32_t>(((value & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+}
+
+// Loads eight bytes with the first byte in the lowest byte, regardless of endianness
+template <typename T>
+std::uint64_t load_eight_bytes(const T* bytes) noexcept
+{
+    std::uint64_t value = 0;
+    for (int i = 7; i >= 0; --i) {
+        value = (value << 8) | static_cast<unsigned char>(bytes[i]);
+    }
+    return value;
+}
+
+// The digit values of a significand
+class digit_values
+{
+public:
+    digit_values(const unsigned char* digits, std::size_t size) noexcept
+        : m_digits(digits), m_size(size)
+    {}
+
+    std::size_t size() const noexcept { return m_size; }
+
+    unsigned char operator[](std::size_t i) const noexcept { return m_digits[i]; }
+
+    // Returns true if the decimal digits [i, i + 8) can be combined with combine_eight_digits
+    bool has_eight_digits(std::size_t i) const noexcept { return i + 8 <= m_size; }
+
+    std::uint32_t eight_digits(std::size_t i) const noexcept { return combine_eight_digits(load_eight_bytes(m_digits + i)); }
+
+private:
+    const unsigned char* m_digits;
+    std::size_t m_size;
+};
+
+// The decimal digits of a significand as characters, with the decimal point after the `point`th digit.
+// If there is no decimal point, `point` equals `size`.
+class digit_chars
+{
+public:
+    digit_chars(const char* digits, std::size_t size, std::size_t point) noexcept
+        : m_digits(digits), m_size(size), m_point(point)
+    {}
+
+    std::size_t size() const noexcept { return m_size; }
+
+    unsigned char operator[](std::size_t i) const noexcept { return static_cast<unsigned char>(m_digits[index(i)] - '0'); }
+
+    // Returns true if the decimal digits [i, i + 8) can be combined with combine_eight_digits
+    bool has_eight_digits(std::size_t i) const noexcept { return i + 8 <= m_size && (i >= m_point || i + 8 <= m_point); }
+
+    std::uint32_t eight_digits(std::size_t i) const noexcept { return combine_eight_digits(load_eight_bytes(m_digits + index(i))); }
+
+private:
+    // Skips the decimal point
+    std::size_t index(std::size_t i) const noexcept { return (i < m_point) ? i : i + 1; }
+
+    const char* m_digits;
+    std::size_t m_size;
+    std::size_t m_point;
+};
+
+// A number as parsed by operator>>, before its conversion to a fixed-point number
+template <typename Significand>
+struct stream_number
+{
+    Significand significand;
+    std::size_t fraction_start;  // the index of the first fractional digit in the significand
+    int base;                    // 10, or 16 for hexfloats with a base-2 exponent
+    bool negate;
+    bool exponent_negate;
+    bool exponent_overflow;
+    std::size_t exponent;
+};
+
+// Converts a parsed number to a fixed-point number
+template <typename B, typename I, unsigned int F, bool R, typename Significand>
+fixed<B, I, F, R> to_fixed(stream_number<Significand> number) noexcept
+{
+    const auto& significand = number.significand;
+    const auto base = number.base;
+    auto fraction_start = number.fraction_start;
+    auto exponent = number.exponent;
+
+    if (number.exponent_overflow) {
+        // Absolute exponent is too large
+        bool zero = true;
+        for (std::size_t i = 0; i < significand.size(); ++i) {
+            zero = zero && (significand[i] == 0);
+        }
+        if (zero) {
+            // Significand is zero. Exponent doesn't matter.
+            return fixed<B, I, F, R>(0);
+        } else if (number.exponent_negate) {
+            // A huge negative exponent approaches 0.
+            return fixed<B, I, F, R>::from_raw_value(0);
+        } else {
+            // A huge positive exponent approaches infinity.
+            return std::numeric_limits<fixed<B, I, F, R>>::max();
+        }
+    }
+
+    // Shift the fraction offset according to exponent
+    {
+        const auto exponent_mult = (base == 10) ? 1: 4;
+        if (number.exponent_negate) {
+            const auto adjust = std::min(exponent / exponent_mult, fraction_start);
+            fraction_start -= adjust;
+            exponent -= adjust * exponent_mult;
+        } else {
+            const auto adjust = std::min(exponent / exponent_mult, significand.size() - fraction_start);
+            fraction_start += adjust;
+            exponent -= adjust * exponent_mult;
+        }
+    }
+
+    constexpr auto IsSigned = std::is_signed<B>::value;
+    constexpr auto IntBits = sizeof(B) * 8 - F - (IsSigned ? 1 : 0);
+    constexpr auto MaxInt = (I{1} << IntBits) - 1;
+    constexpr auto MaxFraction = (I{1} << F) - 1;
+    constexpr auto MaxValue = (I{1} << sizeof(B) * 8) - 1;
+
+    // Combining eight decimal digits at a time needs an intermediate type of more than 32 bits,
+    // and for the integer part, room to not overflow it
+    constexpr bool CombineDigits = (std::numeric_limits<I>::digits > 32);
+    constexpr I EightDigits = CombineDigits ? I(100000000) : I(1);
+    constexpr bool CombineIntegerDigits = CombineDigits && (MaxInt < std::numeric_limits<I>::max() / EightDigits - 10);
+
+    const auto saturated = number.negate ? std::numeric_limits<fixed<B, I, F, R>>::min() : std::numeric_limits<fixed<B, I, F, R>>::max();
+
+    // Parse the integer part
+    I integer = 0;
+    for (std::size_t i = 0; i < fraction_start; ) {
+        if (CombineIntegerDigits && base == 10 && i + 8 <= fraction_start && significand.has_eight_digits(i)) {
+            // The integer increases with every digit, so if it overflows before the last of the
+            // eight digits, it does so before that digit.
+            integer = integer * EightDigits + significand.eight_digits(i);
+            if (integer / 10 > MaxInt / 10) {
+                return saturated;
+            }
+            i += 8;
+            continue;
+        }
+        if (integer > MaxInt / base) {
+            // Overflow
+            return saturated;
+        }
+        assert(significand[i] < base);
+        integer = integer * base + significand[i];
+        ++i;
+    }
+
+    // Parse the fractional part
+    I fraction = 0;
+    I divisor = 1;
+    for (std::size_t i = fraction_start; i < significand.size(); ) {
+        if (CombineDigits && base == 10 && divisor <= MaxFraction / EightDigits && significand.has_eight_digits(i)) {
+            // All eight digits fit
+            fraction = fraction * EightDigits + significand.eight_digits(i);
+            divisor *= EightDigits;
+            i += 8;
+            continue;
+        }
+        assert(significand[i] < base);
+        if (divisor > MaxFraction / base) {
+            // We're done
+            break;
+        }
+        fraction = fraction * base + significand[i];
+        divisor *= base;
+        ++i;
+    }
+
+    // Construct the value from the parsed parts
+    I raw_value = (integer << F) + (fraction << F) / divisor;
+
+    // Apply remaining exponent
+    if (base == 16) {
+        // Base-2 exponent
+        if (number.exponent_negate) {
+            raw_value >>= exponent;
+        } else {
+            raw_value <<= exponent;
+        }
+    } else {
+        // Base-10 exponent
+        if (number.exponent_negate) {
+            I remainder = 0;
+            for (std::size_t e = 0; e < exponent; ++e) {
+                remainder = raw_value % 10;
+                raw_value /= 10;
+            }
+            raw_value += remainder / 5;
+        } else {
+            for (std::size_t e = 0; e < exponent; ++e) {
+                if (raw_value > MaxValue / 10) {
+                    // Overflow
+                    return saturated;
+                }
+                raw_value *= 10;
+            }
+        }
+    }
+    return fixed<B, I, F, R>::from_raw_value(static_cast<B>(number.negate ? -raw_value : raw_value));
+}
+
+// Gives access to the get area of a stream buffer
+template <typename CharT, typename Traits>
+class get_area : public std::basic_streambuf<CharT, Traits>
+{
+    using streambuf = std::basic_streambuf<CharT, Traits>;
+
+public:
+    static const CharT* next(streambuf& buffer) { return (buffer.*&get_area::gptr)(); }
+    static const CharT* end(streambuf& buffer) { return (buffer.*&get_area::egptr)(); }
+    static void bump(streambuf& buffer, int count) { (buffer.*&get_area::gbump)(count); }
+};
+
+// Parses a number from the buffered characters of the stream without going through its locale,
+// if that gives the same result as the general path of operator>>. Returns false if it doesn't.
+template <typename CharT, class Traits, typename B, typename I, unsigned int F, bool R>
+bool read_buffered(std::basic_istream<CharT, Traits>&, fixed<B, I, F, R>&)
+{
+    return false;
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+bool read_buffered(std::basic_istream<char, std::char_traits<char>>& is, fixed<B, I, F, R>& x)
+{
+    auto& buffer = *is.rdbuf();
+    const char* const first = get_area<char, std::char_traits<char>>::next(buffer);
+    const char* const last = get_area<char, std::char_traits<char>>::end(buffer);
+    if (first == last || is.getloc() != std::locale::classic()) {
+        return false;
+    }
+
+    const auto is_digit = [](char ch) { return ch >= '0' && ch <= '9'; };
+
+    stream_number<digit_chars> number{ digit_chars(nullptr, 0, 0), 0, 10, false, false, false, 0 };
+    const char* p = first;
+    if (*p == '-' || *p == '+') {
+        number.negate = (*p++ == '-');
+    }
+
+    // Leave hexfloats to the general path
+    if (last - p >= 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+        return false;
+    }
+
+    // Parse the significand
+    const char* const digits = p;
+    const char* point = nullptr;
+    for (; p != last; ++p) {
+        if (*p == '.' && point == nullptr) {
+            point = p;
+        } else if (!is_digit(*p)) {
+            break;
+        }
+    }
+    const auto size = static_cast<std::size_t>(p - digits) - (point != nullptr ? 1 : 0);
+    if (size == 0) {
+        // Leave errors and infinity to the general path
+        return false;
+    }
+    number.fraction_start = (point != nullptr) ? static_cast<std::size_t>(point - digits) : size;
+    number.significand = digit_chars(digits, size, number.fraction_start);
+
+    // Parse the exponent
+    if (p != last && (*p == 'e' || *p == 'E')) {
+        ++p;
+        if (p != last && (*p == '-' || *p == '+')) {
+            number.exponent_negate = (*p++ == '-');
+        }
+        if (p == last || !is_digit(*p)) {
+            return false;
+        }
+        for (; p != last && is_digit(*p); ++p) {
+            if (number.exponent <= std::numeric_limits<int>::max() / 10) {
+                number.exponent = number.exponent * 10 + static_cast<std::size_t>(*p - '0');
+            } else {
+                number.exponent_overflow = true;
+            }
+        }
+    }
+
+    // Without a character after the number, the number may continue past the buffer
+    if (p == last) {
+        return false;
+    }
+
+    x = to_fixed<B, I, F, R>(number);
+    get_area<char, std::char_traits<char>>::bump(buffer, static_cast<int>(p - first));
+    return true;
+}
+
+}
 
 template <typename CharT, class Traits, typename B, typename I, unsigned int F, bool R>
 std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>& is, fixed<B, I, F, R>& x)
@@ -473,6 +988,12 @@ std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>&
         return is;
     }
 
+    // Fast path: parse the number directly from the stream's buffer if we can
+    if (detail::read_buffered(is, x))
+    {
+        return is;
+    }
+
     const auto& ctype = std::use_facet<std::ctype<CharT>>(is.getloc());
     const auto& numpunct = std::use_facet<std::numpunct<CharT>>(is.getloc());
 
@@ -640,98 +1161,9 @@ std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>&
     }
 
     // We've parsed all we need. Construct the value.
-    if (exponent_overflow) {
-        // Absolute exponent is too large
-        if (std::all_of(significand.begin(), significand.end(), [](unsigned char x){ return x == 0; })) {
-            // Significand is zero. Exponent doesn't matter.
-            x = fixed<B, I, F, R>(0);
-        } else if (exponent_negate) {
-            // A huge negative exponent approaches 0.
-            x = fixed<B, I, F, R>::from_raw_value(0);
-        } else {
-            // A huge positive exponent approaches infinity.
-            x = std::numeric_limits<fixed<B, I, F, R>>::max();
-        }
-        return is;
-    }
-
-    // Shift the fraction offset according to exponent
-    {
-        const auto exponent_mult = (base == 10) ? 1: 4;
-        if (exponent_negate) {
-            const auto adjust = std::min(exponent / exponent_mult, fraction_start);
-            fraction_start -= adjust;
-            exponent -= adjust * exponent_mult;
-        } else {
-            const auto adjust = std::min(exponent / exponent_mult, significand.size() - fraction_start);
-            fraction_start += adjust;
-            exponent -= adjust * exponent_mult;
-        }
-    }
-
-    constexpr auto IsSigned = std::is_signed<B>::value;
-    constexpr auto IntBits = sizeof(B) * 8 - F - (IsSigned ? 1 : 0);
-    constexpr auto MaxInt = (I{1} << IntBits) - 1;
-    constexpr auto MaxFraction = (I{1} << F) - 1;
-    constexpr auto MaxValue = (I{1} << sizeof(B) * 8) - 1;
-
-    // Parse the integer part
-    I integer = 0;
-    for (std::size_t i = 0; i < fraction_start; ++i) {
-        if (integer > MaxInt / base) {
-            // Overflow
-            x = negate ? std::numeric_limits<fixed<B, I, F, R>>::min() : std::numeric_limits<fixed<B, I, F, R>>::max();
-            return is;
-        }
-        assert(significand[i] < base);
-        integer = integer * base + significand[i];
-    }
-
-    // Parse the fractional part
-    I fraction = 0;
-    I divisor = 1;
-    for (std::size_t i = fraction_start; i < significand.size(); ++i) {
-        assert(significand[i] < base);
-        if (divisor > MaxFraction / base) {
-            // We're done
-            break;
-        }
-        fraction = fraction * base + significand[i];
-        divisor *= base;
-    }
-
-    // Construct the value from the parsed parts
-    I raw_value = (integer << F) + (fraction << F) / divisor;
-
-    // Apply remaining exponent
-    if (exponent_char == 'p') {
-        // Base-2 exponent
-        if (exponent_negate) {
-            raw_value >>= exponent;
-        } else {
-            raw_value <<= exponent;
-        }
-    } else {
-        // Base-10 exponent
-        if (exponent_negate) {
-            I remainder = 0;
-            for (std::size_t e = 0; e < exponent; ++e) {
-                remainder = raw_value % 10;
-                raw_value /= 10;
-            }
-            raw_value += remainder / 5;
-        } else {
-            for (std::size_t e = 0; e < exponent; ++e) {
-                if (raw_value > MaxValue / 10) {
-                    // Overflow
-                    x = negate ? std::numeric_limits<fixed<B, I, F, R>>::min() : std::numeric_limits<fixed<B, I, F, R>>::max();
-                    return is;
-                }
-                raw_value *= 10;
-            }
-        }
-    }
-    x = fixed<B, I, F, R>::from_raw_value(static_cast<B>(negate ? -raw_value : raw_value));
+    const detail::digit_values digits(significand.data(), significand.size());
+    x = detail::to_fixed<B, I, F, R>(detail::stream_number<detail::digit_values>{
+        digits, fraction_start, base, negate, exponent_negate, exponent_overflow, exponent });
     return is;
 }
 
@@ -0,0 +1,189 @@
+#ifndef FPM_MAPPED_FILE_HPP
+#define FPM_MAPPED_FILE_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <system_error>
+
+#if defined(_WIN32)
+// Keep the min and max macros and the rarely used APIs of <windows.h> out of the including code
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#define FPM_UNDEF_NOMINMAX
+#endif
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#define FPM_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#if defined(FPM_UNDEF_NOMINMAX)
+#undef NOMINMAX
+#undef FPM_UNDEF_NOMINMAX
+#endif
+#if defined(FPM_UNDEF_WIN32_LEAN_AND_MEAN)
+#undef WIN32_LEAN_AND_MEAN
+#undef FPM_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fpm
+{
+namespace detail
+{
+
+#if defined(_WIN32)
+// Translates a Windows error code, as returned by GetLastError, to the nearest std::errc
+inline std::errc errc_from_win32(DWORD error) noexcept
+{
+    switch (error) {
+    case ERROR_FILE_NOT_FOUND:
+    case ERROR_PATH_NOT_FOUND:
+    case ERROR_INVALID_DRIVE:
+    case ERROR_BAD_NETPATH:
+    case ERROR_BAD_NET_NAME:
+        return std::errc::no_such_file_or_directory;
+    case ERROR_ACCESS_DENIED:
+        return std::errc::permission_denied;
+    case ERROR_SHARING_VIOLATION:
+    case ERROR_LOCK_VIOLATION:
+        return std::errc::device_or_resource_busy;
+    case ERROR_INVALID_NAME:
+    case ERROR_DIRECTORY:
+        return std::errc::invalid_argument;
+    case ERROR_FILENAME_EXCED_RANGE:
+        return std::errc::filename_too_long;
+    case ERROR_TOO_MANY_OPEN_FILES:
+        return std::errc::too_many_files_open;
+    case ERROR_NOT_ENOUGH_MEMORY:
+    case ERROR_OUTOFMEMORY:
+    case ERROR_COMMITMENT_LIMIT:
+        return std::errc::not_enough_memory;
+    default:
+        return std::errc::io_error;
+    }
+}
+#endif
+
+// A read-only memory-mapped file
+class mapped_file
+{
+public:
+    mapped_file() noexcept = default;
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    // Takes over the mapping of `other`, which is left closed
+    mapped_file(mapped_file&& other) noexcept
+        : m_data(other.m_data), m_size(other.m_size)
+    {
+        other.m_data = nullptr;
+        other.m_size = 0;
+    }
+
+    mapped_file& operator=(mapped_file&& other) noexcept
+    {
+        if (this != &other) {
+            close();
+            m_data = other.m_data;
+            m_size = other.m_size;
+            other.m_data = nullptr;
+            other.m_size = 0;
+        }
+        return *this;
+    }
+
+    ~mapped_file()
+    {
+        close();
+    }
+
+    // Maps the file. Returns std::errc{} on success, or the reason of failure.
+    std::errc open(const char* path) noexcept
+    {
+        close();
+#if defined(_WIN32)
+        const HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return errc_from_win32(GetLastError());
+        }
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size)) {
+            const DWORD error = GetLastError();
+            CloseHandle(file);
+            return errc_from_win32(error);
+        }
+        m_size = static_cast<std::size_t>(size.QuadPart);
+        DWORD error = ERROR_SUCCESS;
+        if (m_size > 0) {
+            const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr) {
+                m_data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                error = (m_data == nullptr) ? GetLastError() : ERROR_SUCCESS;
+                CloseHandle(mapping);
+            } else {
+                error = GetLastError();
+            }
+        }
+        CloseHandle(file);
+        if (m_size > 0 && m_data == nullptr) {
+            m_size = 0;
+            return errc_from_win32(error);
+        }
+#else
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            return static_cast<std::errc>(errno);
+        }
+        struct stat status;
+        if (::fstat(fd, &status) != 0) {
+            const int error = errno;
+            ::close(fd);
+            return static_cast<std::errc>(error);
+        }
+        m_size = static_cast<std::size_t>(status.st_size);
+        if (m_size > 0) {
+            void* const data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                const int error = errno;
+                ::close(fd);
+                m_size = 0;
+                return static_cast<std::errc>(error);
+            }
+            ::madvise(data, m_size, MADV_SEQUENTIAL);
+            m_data = static_cast<const char*>(data);
+        }
+        ::close(fd);
+#endif
+        return std::errc{};
+    }
+
+    void close() noexcept
+    {
+        if (m_data != nullptr) {
+#if defined(_WIN32)
+            UnmapViewOfFile(m_data);
+#else
+            ::munmap(const_cast<char*>(m_data), m_size);
+#endif
+        }
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    const char* data() const noexcept { return m_data; }
+    std::size_t size() const noexcept { return m_size; }
+
+private:
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+};
+
+}
+}
+
+#endif
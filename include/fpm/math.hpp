@@ -2,6 +2,7 @@
 #define FPM_MATH_HPP
 
 #include "fixed.hpp"
+#include <algorithm>
 #include <cmath>
 
 #ifdef _MSC_VER
@@ -40,8 +41,850 @@ inline long find_highest_bit(unsigned long long value) noexcept
 #endif
 }
 
+// log2(e) as Q1.31 and ln(2) as Q0.32
+constexpr std::uint32_t LOG2E = 3098164009u;
+constexpr std::uint32_t LN2 = 2977044472u;
+
+// The kernels below calculate with 64-bit intermediate values, which must hold the product of a raw value
+// and a 32-bit number. This requires a BaseType of at most 32 bits.
+template <typename B>
+struct is_narrow : std::integral_constant<bool, (sizeof(B) <= 4)> {};
+
+// Selects the overload of a function for BaseTypes that the kernels support, or for wider ones,
+// which use generic calculations with the IntermediateType instead
+template <typename B>
+using enable_if_narrow = typename std::enable_if<is_narrow<B>::value>::type;
+
+template <typename B>
+using enable_if_wide = typename std::enable_if<!is_narrow<B>::value>::type;
+
+// Shifts an unsigned value right by `shift` bits (or left, if `shift` is negative).
+// If Round is true, the result is rounded to nearest, with ties away from zero.
+template <bool Round>
+inline std::uint64_t shift_right(std::uint64_t value, int shift) noexcept
+{
+    if (shift <= 0) {
+        return (shift > -64) ? value << -shift : 0;
+    }
+    if (shift >= 64) {
+        return 0;
+    }
+    return (value >> shift) + (Round ? (value >> (shift - 1)) & 1 : 0);
+}
+
+// Shifts a signed value right by `shift` bits (or left, if `shift` is negative).
+// The magnitude is shifted, so that rounding is symmetrical around zero.
+template <bool Round>
+inline std::int64_t shift_right_signed(std::int64_t value, int shift) noexcept
+{
+    return (value < 0) ? -static_cast<std::int64_t>(shift_right<Round>(0 - static_cast<std::uint64_t>(value), shift))
+                       :  static_cast<std::int64_t>(shift_right<Round>(static_cast<std::uint64_t>(value), shift));
+}
+
+// Multiplies a signed value by an unsigned 32-bit factor and shifts the product right by `shift` bits.
+// The magnitude is shifted, so that rounding is symmetrical around zero.
+// If the value does not fit in 32 bits, the 96-bit product is split, which requires 0 <= shift <= 32.
+template <bool Round, typename T>
+inline T mul_shift(T value, std::uint32_t factor, int shift) noexcept
+{
+    const bool negative = value < 0;
+    const std::uint64_t magnitude = negative ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+    std::uint64_t result;
+    if ((magnitude >> 32) == 0) {
+        result = shift_right<Round>(magnitude * factor, shift);
+    } else {
+        // Without a shift, the product itself must fit in 64 bits
+        assert(shift >= 0 && shift <= 32);
+        const std::uint64_t hi = (magnitude >> 32) * factor;
+        const std::uint64_t lo = (magnitude & 0xFFFFFFFF) * factor;
+        result = (hi << (32 - shift)) + shift_right<Round>(lo, shift);
+    }
+    return static_cast<T>(negative ? 0 - result : result);
+}
+
+// Calculates an approximation of 1/sqrt(m) for m in [1,4) as Q2.30.
+//
+// Returns a Q1.31 value. The seed is linearly interpolated from a table and refined with a single
+// Newton-Raphson iteration, y' = y * (3 - m*y*y) / 2. The relative error of the result is less than 2^-29.
+inline std::uint64_t rsqrt_normalized(std::uint64_t m) noexcept
+{
+    // Start (Q1.31) and negated slope (Q0.23) of the best linear fit of 1/sqrt(m) on 192 equal intervals of m in [1,4)
+    static constexpr std::uint32_t starts[192] = {
+        2147459544, 2130877320, 2114673381, 2098833558, 2083344418, 2068193208, 2053367818, 2038856734,
+        2024649006, 2010734210, 1997102416, 1983744160, 1970650415, 1957812565, 1945222382, 1932872005,
+        1920753916, 1908860924, 1897186145, 1885722987, 1874465134, 1863406530, 1852541365, 1841864065,
+        1831369279, 1821051864, 1810906882, 1800929580, 1791115392, 1781459920, 1771958932, 1762608352,
+        1753404253, 1744342850, 1735420494, 1726633664, 1717978965, 1709453117, 1701052955, 1692775421,
+        1684617559, 1676576515, 1668649525, 1660833920, 1653127116, 1645526610, 1638029981, 1630634886,
+        1623339052, 1616140278, 1609036432, 1602025445, 1595105312, 1588274087, 1581529883, 1574870867,
+        1568295262, 1561801340, 1555387425, 1549051886, 1542793140, 1536609649, 1530499917, 1524462488,
+        1518495948, 1512598920, 1506770064, 1501008079, 1495311694, 1489679674, 1484110816, 1478603948,
+        1473157930, 1467771647, 1462444017, 1457173982, 1451960512, 1446802602, 1441699273, 1436649569,
+        1431652557, 1426707327, 1421812990, 1416968680, 1412173551, 1407426776, 1402727547, 1398075076,
+        1393468593, 1388907345, 1384390597, 1379917629, 1375487739, 1371100240, 1366754461, 1362449743,
+        1358185446, 1353960939, 1349775608, 1345628851, 1341520079, 1337448717, 1333414199, 1329415973,
+        1325453498, 1321526246, 1317633696, 1313775341, 1309950684, 1306159236, 1302400520, 1298674067,
+        1294979419, 1291316125, 1287683745, 1284081846, 1280510005, 1276967805, 1273454839, 1269970708,
+        1266515018, 1263087385, 1259687431, 1256314786, 1252969085, 1249649974, 1246357100, 1243090120,
+        1239848696, 1236632497, 1233441198, 1230274479, 1227132025, 1224013529, 1220918688, 1217847204,
+        1214798785, 1211773144, 1208769998, 1205789069, 1202830087, 1199892781, 1196976890, 1194082154,
+        1191208318, 1188355133, 1185522351, 1182709732, 1179917036, 1177144031, 1174390485, 1171656172,
+        1168940870, 1166244358, 1163566422, 1160906848, 1158265429, 1155641958, 1153036233, 1150448054,
+        1147877227, 1145323558, 1142786856, 1140266935, 1137763611, 1135276702, 1132806029, 1130351417,
+        1127912693, 1125489685, 1123082226, 1120690150, 1118313294, 1115951497, 1113604601, 1111272450,
+        1108954890, 1106651769, 1104362939, 1102088252, 1099827562, 1097580728, 1095347608, 1093128064,
+        1090921957, 1088729153, 1086549520, 1084382925, 1082229239, 1080088335, 1077960086, 1075844368
+    };
+    static constexpr std::uint16_t slopes[192] = {
+        64778, 63300, 61878, 60507, 59187, 57914, 56687, 55501, 54357, 53251, 52183, 51149, 50150, 49182, 48245, 47338,
+        46459, 45606, 44779, 43977, 43199, 42443, 41709, 40996, 40304, 39630, 38975, 38338, 37718, 37114, 36527, 35954,
+        35397, 34854, 34324, 33808, 33305, 32814, 32335, 31867, 31411, 30965, 30530, 30105, 29690, 29284, 28888, 28500,
+        28121, 27750, 27387, 27032, 26685, 26345, 26012, 25686, 25367, 25055, 24749, 24449, 24155, 23866, 23584, 23307,
+        23036, 22769, 22508, 22252, 22000, 21754, 21511, 21274, 21040, 20811, 20586, 20365, 20148, 19935, 19726, 19520,
+        19318, 19119, 18923, 18731, 18542, 18357, 18174, 17994, 17818, 17644, 17473, 17304, 17139, 16976, 16815, 16658,
+        16502, 16349, 16198, 16050, 15904, 15760, 15618, 15479, 15341, 15205, 15072, 14940, 14810, 14683, 14557, 14432,
+        14310, 14189, 14070, 13953, 13837, 13723, 13610, 13499, 13389, 13281, 13174, 13069, 12965, 12863, 12762, 12662,
+        12563, 12466, 12370, 12275, 12182, 12089, 11998, 11908, 11819, 11731, 11644, 11559, 11474, 11390, 11308, 11226,
+        11145, 11066, 10987, 10909, 10832, 10756, 10681, 10607, 10533, 10461, 10389, 10318, 10248, 10179, 10110, 10042,
+        9975, 9909, 9843, 9779, 9715, 9651, 9588, 9526, 9465, 9404, 9344, 9285, 9226, 9168, 9110, 9053,
+        8997, 8941, 8886, 8831, 8777, 8723, 8670, 8618, 8566, 8514, 8463, 8413, 8363, 8314, 8265, 8216
+    };
+    assert(m >= (std::uint64_t{1} << 30) && m < (std::uint64_t{1} << 32));
+
+    // The top eight bits of m select the interval, the remaining bits are the position within it
+    const std::size_t index = static_cast<std::size_t>(m >> 24) - 64;
+    const std::uint64_t y = starts[index] - ((slopes[index] * (m & 0xFFFFFF)) >> 16);
+
+    const std::uint64_t myy = (m * ((y * y) >> 31)) >> 30;
+    return (y * ((std::uint64_t{3} << 31) - myy)) >> 32;
+}
+
+// Normalizes a non-zero value to m in [1,4) as Q2.30, so that value = m * 2^(30 + e), with e even.
+inline std::uint64_t normalize_even(std::uint64_t value, int* e) noexcept
+{
+    const int highest = static_cast<int>(find_highest_bit(value));
+    *e = (highest - 30) - ((highest - 30) & 1);
+    return (*e >= 0) ? (value >> *e) : (value << -*e);
+}
+
+// Calculates an approximation of 1/sqrt(value), assuming value != 0.
+// Returns a Q1.31 mantissa `y` such that 1/sqrt(value) ~= y / 2^exponent,
+// with a relative error of less than 2^-29.
+inline std::uint32_t rsqrt_kernel(std::uint64_t value, int* exponent) noexcept
+{
+    int e;
+    const std::uint64_t m = normalize_even(value, &e);
+    *exponent = 31 + 15 + e / 2;
+    return static_cast<std::uint32_t>(rsqrt_normalized(m));
+}
+
+// Calculates sqrt(value), rounded to nearest, assuming value < 2^62.
+inline std::uint64_t sqrt_kernel(std::uint64_t value) noexcept
+{
+    assert(value < (std::uint64_t{1} << 62));
+    if (value == 0) {
+        return 0;
+    }
+
+    // sqrt(m) = m * 1/sqrt(m), as Q1.31. Shift it to get an estimate of sqrt(value) = sqrt(m) * 2^(15 + e/2).
+    int e;
+    const std::uint64_t m = normalize_even(value, &e);
+    std::uint64_t res = shift_right<false>((m * rsqrt_normalized(m)) >> 30, 16 - e / 2);
+
+    // The estimate is off by at most a few units. Correct it to the exact integer square root
+    // by adjusting the remainder, value - res^2.
+    std::int64_t rem = static_cast<std::int64_t>(value - res * res);
+    while (rem < 0) {
+        --res;
+        rem += static_cast<std::int64_t>(2 * res + 1);
+    }
+    while (rem > static_cast<std::int64_t>(2 * res)) {
+        rem -= static_cast<std::int64_t>(2 * res + 1);
+        ++res;
+    }
+
+    // Round the last digit up if necessary
+    if (rem > static_cast<std::int64_t>(res)) {
+        ++res;
+    }
+    return res;
+}
+
+// Returns the square of the magnitude of a raw value
+template <typename T>
+inline std::uint64_t square_magnitude(T value) noexcept
+{
+    const std::uint64_t magnitude = (value < 0) ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+    return magnitude * magnitude;
+}
+
+// Calculates an approximation of 1/cbrt(m) for m in [1,8) as Q3.29.
+//
+// Returns a Q1.31 value. The seed is linearly interpolated from a table and refined with two
+// Newton-Raphson iterations, z' = z * (4 - m*z*z*z) / 3.
+inline std::uint64_t rcbrt_normalized(std::uint64_t m) noexcept
+{
+    // Start (Q1.31) and negated slope (Q0.32) of the best linear fit of 1/cbrt(m) on 56 equal intervals of m in [1,8)
+    static constexpr std::uint32_t starts[56] = {
+        2146672283, 2064179358, 1993052150, 1930807350, 1875670338, 1826333006, 1781805988, 1741324578,
+        1704286643, 1670210388, 1638704866, 1609448895, 1582175702, 1556661522, 1532716994, 1510180595,
+        1488913542, 1468795800, 1449722914, 1431603486, 1414357123, 1397912779, 1382207387, 1367184735,
+        1352794526, 1338991592, 1325735241, 1312988687, 1300718586, 1288894622, 1277489162, 1266476956,
+        1255834873, 1245541680, 1235577841, 1225925347, 1216567563, 1207489094, 1198675672, 1190114044,
+        1181791887, 1173697719, 1165820832, 1158151219, 1150679520, 1143396968, 1136295339, 1129366912,
+        1122604428, 1116001053, 1109550350, 1103246248, 1097083014, 1091055229, 1085157770, 1079385784
+    };
+    static constexpr std::uint32_t slopes[56] = {
+        1322859770, 1140123011, 997433679, 883325696, 790264505, 713109129, 648240008, 593040154,
+        545573839, 504380656, 468339548, 436576686, 408401605, 383262031, 360711340, 340384730,
+        321981524, 305251829, 289986383, 276008709, 263169020, 251339416, 240410074, 230286208,
+        220885604, 212136639, 203976639, 196350552, 189209831, 182511515, 176217459, 170293686,
+        164709842, 159438727, 154455906, 149739369, 145269243, 141027537, 136997936, 133165604,
+        129517029, 126039876, 122722868, 119555670, 116528801, 113633543, 110861872, 108206385,
+        105660249, 103217141, 100871207, 98617019, 96449535, 94364068, 92356255, 90422030
+    };
+    assert(m >= (std::uint64_t{1} << 29) && m < (std::uint64_t{1} << 32));
+
+    // The top six bits of m select the interval, the remaining bits are the position within it
+    const std::size_t index = static_cast<std::size_t>(m >> 26) - 8;
+    std::uint64_t z = starts[index] - ((slopes[index] * (m & 0x3FFFFFF)) >> 30);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        const std::uint64_t mzzz = (m * ((((z * z) >> 31) * z) >> 31)) >> 29;
+        z = ((z * ((std::uint64_t{4} << 31) - mzzz)) >> 31) / 3;
+    }
+    return z;
+}
+
+// Returns true if a^3 <= value * 2^shift, assuming a < 2^32 and shift < 64.
+// Both sides are compared as 128-bit numbers, so neither can overflow.
+inline bool cube_less_equal(std::uint64_t a, std::uint64_t value, int shift) noexcept
+{
+    // a^3 = a^2 * a, with the 64-bit a^2 split into two halves
+    const std::uint64_t a2 = a * a;
+    const std::uint64_t lo = (a2 & 0xFFFFFFFF) * a;
+    const std::uint64_t hi = (a2 >> 32) * a;
+    const std::uint64_t cube_lo = lo + (hi << 32);
+    const std::uint64_t cube_hi = (hi >> 32) + (cube_lo < lo ? 1 : 0);
+
+    const std::uint64_t value_lo = value << shift;
+    const std::uint64_t value_hi = (shift == 0) ? 0 : value >> (64 - shift);
+    return cube_hi < value_hi || (cube_hi == value_hi && cube_lo <= value_lo);
+}
+
+// Calculates floor(cbrt(value * 2^shift)), assuming value != 0 and value * 2^shift < 2^93.
+inline std::uint64_t cbrt_kernel(std::uint64_t value, int shift) noexcept
+{
+    const int total = static_cast<int>(find_highest_bit(value)) + shift;
+    assert(total < 93 && shift < 64);
+
+    // Normalize to m in [1,8) as Q3.29, so that value * 2^shift = m * 2^(3q)
+    const int q = total / 3;
+    const std::uint64_t m = shift_right<false>(value, 3 * q - 29 - shift);
+
+    // cbrt(m) = m * (1/cbrt(m))^2, as Q3.60. Shift it to get an estimate of cbrt(m) * 2^q.
+    const std::uint64_t z = rcbrt_normalized(m);
+    std::uint64_t res = (m * ((z * z) >> 31)) >> (60 - q);
+
+    // The estimate is off by at most a few units (m may also have been truncated).
+    // Correct it to the exact integer cube root.
+    while (!cube_less_equal(res, value, shift)) {
+        --res;
+    }
+    while (cube_less_equal(res + 1, value, shift)) {
+        ++res;
+    }
+    return res;
+}
+
+// Calculates 2^(t / 2^fraction), assuming fraction < 63.
+//
+// Returns a Q1.30 mantissa m in [1,2) and sets `exponent` such that the result is m * 2^exponent.
+// The fraction is split into a table lookup of 2^(i/64) and a cubic Taylor polynomial for the
+// remainder, which is less than 1/64. The relative error of the result is less than 2^-29.
+inline std::uint64_t exp2_kernel(std::int64_t t, int fraction, int* exponent) noexcept
+{
+    // 2^(i/64) for i in [0,64), as Q1.31
+    static constexpr std::uint32_t powers[64] = {
+        2147483648, 2170868212, 2194507417, 2218404036, 2242560872, 2266980759, 2291666561, 2316621173,
+        2341847524, 2367348571, 2393127307, 2419186755, 2445529972, 2472160047, 2499080105, 2526293303,
+        2553802834, 2581611923, 2609723834, 2638141863, 2666869345, 2695909648, 2725266179, 2754942382,
+        2784941738, 2815267765, 2845924021, 2876914102, 2908241642, 2939910317, 2971923842, 3004285971,
+        3037000500, 3070071267, 3103502151, 3137297074, 3171459999, 3205994934, 3240905930, 3276197082,
+        3311872529, 3347936457, 3384393094, 3421246719, 3458501653, 3496162267, 3534232978, 3572718252,
+        3611622603, 3650950594, 3690706840, 3730896002, 3771522796, 3812591987, 3854108391, 3896076880,
+        3938502376, 3981389855, 4024744348, 4068570940, 4112874773, 4157661043, 4202935003, 4248701965
+    };
+    assert(fraction >= 0 && fraction < 63);
+
+    // Split t into its integer part (rounded towards negative infinity) and its fraction as Q0.30
+    *exponent = static_cast<int>(t >> fraction);
+    const std::uint64_t f = static_cast<std::uint64_t>(t) & ((std::uint64_t{1} << fraction) - 1);
+    const std::uint64_t f30 = (fraction >= 30) ? (f >> (fraction - 30)) : (f << (30 - fraction));
+
+    // 2^r ~= 1 + r*ln(2) + (r*ln(2))^2/2 + (r*ln(2))^3/6, with coefficients as Q0.30
+    constexpr std::uint64_t c1 = 744261118;  // 6.9314718055994531e-1
+    constexpr std::uint64_t c2 = 257941248;  // 2.4022650695910071e-1
+    constexpr std::uint64_t c3 =  59597083;  // 5.5504108664821580e-2
+    const std::uint64_t r = f30 & 0xFFFFFF;
+    const std::uint64_t p = (std::uint64_t{1} << 30) + (((((((c3 * r) >> 30) + c2) * r) >> 30) + c1) * r >> 30);
+    return (powers[f30 >> 24] * p) >> 31;
+}
+
+// Calculates 2^(t / 2^fraction) as a raw value with F fraction bits
+template <bool Round>
+inline std::uint64_t exp2_fixed(std::int64_t t, int fraction, int F) noexcept
+{
+    int n;
+    const std::uint64_t m = exp2_kernel(t, fraction, &n);
+    return shift_right<Round>(m, 30 - F - n);
+}
+
+// Compile-time sequence of indices, for generating tables (std::index_sequence requires C++14)
+template <std::size_t... Is>
+struct index_sequence {};
+
+template <std::size_t N, std::size_t... Is>
+struct make_index_sequence_impl : make_index_sequence_impl<N - 1, N - 1, Is...> {};
+
+template <std::size_t... Is>
+struct make_index_sequence_impl<0, Is...>
+{
+    using type = index_sequence<Is...>;
+};
+
+template <std::size_t N>
+using make_index_sequence = typename make_index_sequence_impl<N>::type;
+
+// Multiplies two values with `shift` fraction bits, assuming 0 <= shift < 64.
+// The 128-bit product is shifted right, rounding towards negative infinity. It's calculated from 32-bit halves,
+// like the split path of mul_shift, since standard C++ has no 128-bit integer type.
+inline std::int64_t mul_q(std::int64_t a, std::int64_t b, unsigned int shift) noexcept
+{
+    assert(shift < 64);
+    const bool negative = (a < 0) != (b < 0);
+    const std::uint64_t ua = (a < 0) ? 0 - static_cast<std::uint64_t>(a) : static_cast<std::uint64_t>(a);
+    const std::uint64_t ub = (b < 0) ? 0 - static_cast<std::uint64_t>(b) : static_cast<std::uint64_t>(b);
+
+    // Multiply the magnitudes as 32-bit halves
+    const std::uint64_t ll = (ua & 0xFFFFFFFF) * (ub & 0xFFFFFFFF);
+    const std::uint64_t lh = (ua & 0xFFFFFFFF) * (ub >> 32);
+    const std::uint64_t hl = (ua >> 32) * (ub & 0xFFFFFFFF);
+    const std::uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+    std::uint64_t lo = (mid << 32) | (ll & 0xFFFFFFFF);
+    std::uint64_t hi = (ua >> 32) * (ub >> 32) + (lh >> 32) + (hl >> 32) + (mid >> 32);
+
+    // Negate the 128-bit product in two's complement, so the shift rounds like the native one
+    if (negative)
+    {
+        lo = ~lo + 1;
+        hi = ~hi + (lo == 0 ? 1 : 0);
+    }
+    const std::uint64_t result = (shift == 0) ? lo : (lo >> shift) | (hi << (64 - shift));
+    return static_cast<std::int64_t>(result);
+}
+
+// Products of two values with `shift` fraction bits, for the polynomial evaluators.
+// The narrow product requires the product to fit in 64 bits, the wide product only the result.
+struct narrow_product
+{
+    static inline std::int64_t multiply(std::int64_t a, std::int64_t b, unsigned int shift) noexcept
+    {
+        return (a * b) >> shift;
+    }
+};
+
+struct wide_product
+{
+    static inline std::int64_t multiply(std::int64_t a, std::int64_t b, unsigned int shift) noexcept
+    {
+        return mul_q(a, b, shift);
+    }
+};
+
+// Evaluates the polynomial c0 + c1*x + c2*x^2 + ... with Horner's scheme, with all values having Bits fraction bits
+template <typename Product, unsigned int Bits, std::int64_t C>
+inline std::int64_t poly_horner(std::int64_t) noexcept
+{
+    return C;
+}
+
+template <typename Product, unsigned int Bits, std::int64_t C, std::int64_t C1, std::int64_t... Cs>
+inline std::int64_t poly_horner(std::int64_t x) noexcept
+{
+    return C + Product::multiply(poly_horner<Product, Bits, C1, Cs...>(x), x, Bits);
+}
+
+// Evaluates a polynomial with Estrin's scheme, with all values having Bits fraction bits.
+// Each pass combines the N terms pairwise as t[2i] + t[2i+1]*x and squares x, until one term is left.
+// The pairs don't depend on each other, so their multiplications can execute in parallel.
+template <typename Product, unsigned int Bits, std::size_t N>
+struct poly_estrin_pass
+{
+    template <std::size_t... Is>
+    static inline std::int64_t evaluate(const std::int64_t* terms, std::int64_t x, index_sequence<Is...>) noexcept
+    {
+        const std::int64_t next[] = { (2 * Is + 1 < N) ? terms[2 * Is] + Product::multiply(terms[(2 * Is + 1) % N], x, Bits) : terms[2 * Is]... };
+        return poly_estrin_pass<Product, Bits, (N + 1) / 2>::evaluate(next, Product::multiply(x, x, Bits), make_index_sequence<(N + 3) / 4>{});
+    }
+};
+
+template <typename Product, unsigned int Bits>
+struct poly_estrin_pass<Product, Bits, 1>
+{
+    template <std::size_t... Is>
+    static inline std::int64_t evaluate(const std::int64_t* terms, std::int64_t, index_sequence<Is...>) noexcept
+    {
+        return terms[0];
+    }
+};
+
+// Evaluates the polynomial c0 + c1*x + c2*x^2 + ... with Estrin's scheme
+template <typename Product, unsigned int Bits, std::int64_t... Cs>
+inline std::int64_t poly_estrin(std::int64_t x) noexcept
+{
+    const std::int64_t terms[] = { Cs... };
+    return poly_estrin_pass<Product, Bits, sizeof...(Cs)>::evaluate(terms, x, make_index_sequence<(sizeof...(Cs) + 1) / 2>{});
+}
+
+// Returns the first `bits` fraction bits of log2(y), for y in [1,2) as Q1.31.
+// Each squaring of y yields the next bit: if y^2 >= 2, the bit is set and y^2 is halved.
+constexpr std::uint64_t log2_fraction(std::uint64_t y, int bits) noexcept
+{
+    return (bits == 0) ? 0 :
+           (((y * y) >> 31) >= (std::uint64_t{1} << 32))
+               ? (std::uint64_t{1} << (bits - 1)) | log2_fraction((y * y) >> 32, bits - 1)
+               : log2_fraction((y * y) >> 31, bits - 1);
+}
+
+// Returns 1/(1 + i/128), rounded up, as Q1.31
+constexpr std::uint32_t log2_reciprocal(std::size_t i) noexcept
+{
+    return static_cast<std::uint32_t>(((std::uint64_t{1} << 38) + 127 + i) / (128 + i));
+}
+
+// Returns -log2(log2_reciprocal(i)) as Q0.30. This is 1 - log2(2r), with 2r in (1,2] as Q1.31.
+constexpr std::uint32_t log2_reciprocal_log(std::size_t i) noexcept
+{
+    return (i == 0) ? 0 : static_cast<std::uint32_t>((std::uint64_t{1} << 30) - log2_fraction(std::uint64_t{log2_reciprocal(i)} * 2, 30));
+}
+
+template <std::size_t... Is>
+inline std::uint64_t log2_normalized(std::uint64_t m, index_sequence<Is...>) noexcept
+{
+    static constexpr std::uint32_t reciprocals[] = { log2_reciprocal(Is)... };
+    static constexpr std::uint32_t logs[] = { log2_reciprocal_log(Is)... };
+
+    // The top seven fraction bits of m select r ~= 1/m, so that m*r = 1 + u, with u in [0,2^-7)
+    const std::size_t index = static_cast<std::size_t>(m >> 23) - 128;
+    const std::uint64_t u = ((m * reciprocals[index]) >> 31) - (std::uint64_t{1} << 30);
+
+    // log2(1+u) ~= (u - u^2/2 + u^3/3) / ln(2), with coefficients as Q1.30
+    constexpr std::uint64_t c1 = 1549082005; // 1.4426950408889634
+    constexpr std::uint64_t c2 =  774541002; // 7.2134752044448170e-1
+    constexpr std::uint64_t c3 =  516360668; // 4.8089834696298780e-1
+    return logs[index] + ((((c1 - ((((c2 - ((c3 * u) >> 30)) * u) >> 30))) * u) >> 30));
+}
+
+// Calculates log2(m) for m in [1,2) as Q1.30.
+//
+// Returns a Q0.30 value. A 128-entry table, generated at compile time, provides log2(1/r)
+// for r ~= 1/m, and a cubic series evaluates log2(m*r) on the small remainder.
+// The absolute error of the result is less than 2^-29.
+inline std::uint64_t log2_normalized(std::uint64_t m) noexcept
+{
+    assert(m >= (std::uint64_t{1} << 30) && m < (std::uint64_t{1} << 31));
+    return log2_normalized(m, make_index_sequence<128>{});
+}
+
+// Calculates log2(value / 2^F) as Q.30, assuming value != 0
+inline std::int64_t log2_fixed(std::uint64_t value, int F) noexcept
+{
+    const int highest = static_cast<int>(find_highest_bit(value));
+    const std::uint64_t fraction = log2_normalized(shift_right<false>(value, highest - 30));
+    return std::int64_t{highest - F} * (std::int64_t{1} << 30) + static_cast<std::int64_t>(fraction);
+}
+
+// Exponent of pow_fixed: the magnitude and sign of a raw value with F fraction bits.
+// The magnitude is taken as unsigned, so the most negative raw value does not overflow.
+struct pow_exponent
+{
+    explicit pow_exponent(std::int64_t exp) noexcept
+        : magnitude(static_cast<std::uint32_t>(exp < 0 ? 0 - static_cast<std::uint64_t>(exp) : static_cast<std::uint64_t>(exp)))
+        , negative(exp < 0)
+    {
+    }
+
+    std::uint32_t magnitude;
+    bool negative;
+};
+
+// Calculates base^exp as a raw value with F fraction bits, assuming base > 0 and
+// exp is a raw value with F fraction bits whose magnitude fits in 32 bits.
+template <bool Round>
+inline std::uint64_t pow_fixed(std::uint64_t base, pow_exponent exp, int F) noexcept
+{
+    // base^exp = 2^(log2(base) * exp). The logarithm is kept as Q.30 and the product
+    // is formed in 96 bits, so the exponent's precision is not lost before exp2.
+    const std::int64_t magnitude = mul_shift<false>(log2_fixed(base, F), exp.magnitude, F);
+    return exp2_fixed<Round>(exp.negative ? -magnitude : magnitude, 30, F);
+}
+
+// Calculates e^-s for s >= 0, with both as Q.30
+inline std::uint64_t exp_negative(std::int64_t s) noexcept
+{
+    assert(s >= 0);
+    if (s >= (std::int64_t{48} << 30)) {
+        // The result is less than 2^-69
+        return 0;
+    }
+    return exp2_fixed<false>(-mul_shift<false>(s, LOG2E, 31), 30, 30);
+}
+
+// Calculates the logistic function 1 / (1 + e^-s), with both as Q.30
+inline std::uint64_t sigmoid_fixed(std::int64_t s) noexcept
+{
+    constexpr std::uint64_t ONE = std::uint64_t{1} << 30;
+    const std::uint64_t d = exp_negative(s < 0 ? -s : s);
+
+    // For negative s, use 1 - 1 / (1 + e^s) = e^-|s| / (1 + e^-|s|)
+    return ((s < 0 ? d : ONE) << 30) / (ONE + d);
+}
+
+// Converts a raw value with F fraction bits to Q.30, truncating if F > 30
+inline std::int64_t to_q30(std::int64_t value, int F) noexcept
+{
+    return shift_right_signed<false>(value, F - 30);
+}
+
+// Calculates erf(x) for x >= 0 as Q.30.
+//
+// Returns a Q1.31 value. A table holds erf and its derivative, 2/sqrt(pi) * e^-x0^2, at the centers x0 of
+// 72 intervals of width 1/16. The remainder h = x - x0 is at most 1/32, and the Taylor series of erf
+// around x0 is evaluated up to h^5. Its coefficients are Hermite polynomials of x0, which are exact
+// since x0 is a multiple of 1/32. The absolute error of the result is less than 2^-30.
+inline std::uint64_t erf_kernel(std::uint64_t x) noexcept
+{
+    // erf(x0) as Q1.31
+    static constexpr std::uint32_t values[72] = {
+        75699601u, 226508938u, 375562430u, 521734824u, 663966999u, 801288842u, 932838789u, 1057879379u,
+        1175808383u, 1286165294u, 1388633167u, 1483036034u, 1569332286u, 1647604562u, 1718046821u, 1780949315u,
+        1836682228u, 1885678709u, 1928418002u, 1965409255u, 1997176536u, 2024245418u, 2047131417u, 2066330422u,
+        2082311160u, 2095509649u, 2106325505u, 2115119917u, 2122215075u, 2127894791u, 2132406077u, 2135961435u,
+        2138741634u, 2140898769u, 2142559458u, 2143828010u, 2144789485u, 2145512548u, 2146052089u, 2146451557u,
+        2146745017u, 2146958923u, 2147113630u, 2147224651u, 2147303702u, 2147359551u, 2147398702u, 2147425934u,
+        2147444728u, 2147457597u, 2147466342u, 2147472237u, 2147476180u, 2147478797u, 2147480521u, 2147481647u,
+        2147482378u, 2147482847u, 2147483147u, 2147483337u, 2147483456u, 2147483531u, 2147483577u, 2147483605u,
+        2147483622u, 2147483633u, 2147483639u, 2147483643u, 2147483645u, 2147483646u, 2147483647u, 2147483647u
+    };
+    // 2/sqrt(pi) * e^-x0^2 as Q2.30
+    static constexpr std::uint32_t derivatives[72] = {
+        1210405291u, 1200985843u, 1182366283u, 1154976797u, 1119441897u, 1076556752u, 1027257629u, 972587975u,
+        913661848u, 851626486u, 787625745u, 722766011u, 658085942u, 594531104u, 532934237u, 474001523u,
+        418304876u, 366279987u, 318229568u, 274331035u, 234647769u, 199142975u, 167695198u, 140114582u,
+        116159069u, 95549844u, 77985510u, 63154590u, 50746139u, 40458349u, 32005189u, 25121160u,
+        19564379u, 15118181u, 11591511u, 8818357u, 6656445u, 4985447u, 3704869u, 2731799u,
+        1998627u, 1450848u, 1045006u, 746832u, 529583u, 372609u, 260123u, 180182u,
+        123837u, 84449u, 57141u, 38363u, 25555u, 16891u, 11077u, 7208u,
+        4654u, 2981u, 1895u, 1195u, 748u, 464u, 286u, 175u,
+        106u, 64u, 38u, 23u, 13u, 8u, 4u, 3u
+    };
+    constexpr std::int64_t ONE = std::int64_t{1} << 30;
+
+    // Beyond 4.5, 1 - erf(x) is less than 2^-32
+    if (x >= (std::uint64_t{9} << 29)) {
+        return std::uint64_t{1} << 31;
+    }
+
+    // With x0 = k/32, the powers of x0 as Q.30 are k^n * 2^(30 - 5n)
+    const std::size_t index = static_cast<std::size_t>(x >> 26);
+    const std::int64_t k = static_cast<std::int64_t>(2 * index + 1);
+    const std::int64_t h = static_cast<std::int64_t>(x) - (k << 25);
+    const std::int64_t x2 = (k * k) << 20;
+    const std::int64_t x4 = (k * k * k * k) << 10;
+
+    // erf(x0 + h) = erf(x0) + erf'(x0) * h * (1 - x0 h + (2x0^2 - 1)/3 h^2 - (2x0^3 - 3x0)/6 h^3 + (4x0^4 - 12x0^2 + 3)/30 h^4).
+    // The polynomial is split into independent terms in h and h^2, which shortens the chain of multiplications.
+    const std::int64_t c3 = (2 * x2 - ONE) / 3;
+    const std::int64_t c4 = -(k * (2 * x2 - 3 * ONE) / 192);
+    const std::int64_t c5 = (4 * x4 - 12 * x2 + 3 * ONE) / 30;
+    const std::int64_t h2 = (h * h) >> 30;
+    std::int64_t p = ONE - ((k * h) >> 5) + (((c3 + ((c4 * h) >> 30)) * h2) >> 30) + ((c5 * ((h2 * h2) >> 30)) >> 30);
+    p = (p * h) >> 30;
+
+    const std::int64_t result = std::int64_t{values[index]} + ((std::int64_t{derivatives[index]} * p) >> 29);
+    return std::min(static_cast<std::uint64_t>(std::max(result, std::int64_t{0})), std::uint64_t{1} << 31);
+}
+
+// Divides two values with the same scale and returns the quotient as Q.28, assuming |num / den| < 8 and den > 0
+inline std::int64_t divide_q28(std::int64_t num, std::int64_t den) noexcept
+{
+    assert(den > 0);
+
+    // Scale the denominator down to 31 bits, so the shifted numerator fits
+    const int shift = std::max(static_cast<int>(find_highest_bit(static_cast<std::uint64_t>(den))) - 30, 0);
+    return (shift_right_signed<false>(num, shift) * (std::int64_t{1} << 28)) / (den >> shift);
+}
+
+// Calculates the inverse of the standard normal CDF for p in (0, 1/2] as Q.30.
+//
+// Returns a non-positive Q.28 value. This uses Acklam's rational approximations, whose relative error
+// is less than 1.15 * 10^-9: one in p - 1/2 near the center and one in sqrt(-2 log(p)) in the tail.
+inline std::int64_t probit_kernel(std::uint64_t p) noexcept
+{
+    assert(p > 0 && p <= (std::uint64_t{1} << 29));
+    constexpr std::int64_t ONE = std::int64_t{1} << 30;
+
+    if (p >= 26038239u) // 0.02425
+    {
+        // With q = p - 1/2 and r = q^2: x = q * a(r) / b(r), with a and b of degree 5.
+        // Near the tail, b(r) drops to 0.0026, so a and b are evaluated as Q.40.
+        const std::uint32_t q = static_cast<std::uint32_t>((ONE >> 1) - static_cast<std::int64_t>(p));
+        const std::uint32_t r = static_cast<std::uint32_t>((std::uint64_t{q} * q) >> 28);
+        std::int64_t a = -43647126486026;
+        a = mul_shift<false>(a, r, 32) + 242932804329501;
+        a = mul_shift<false>(a, r, 32) - 303386605671354;
+        a = mul_shift<false>(a, r, 32) + 152125956971009;
+        a = mul_shift<false>(a, r, 32) - 33716302037132;
+        a = mul_shift<false>(a, r, 32) + 2756066937579;
+        std::int64_t b = -59897104064522;
+        b = mul_shift<false>(b, r, 32) + 177665506509332;
+        b = mul_shift<false>(b, r, 32) - 171192838788807;
+        b = mul_shift<false>(b, r, 32) + 73448819171239;
+        b = mul_shift<false>(b, r, 32) - 14602263792188;
+        b = mul_shift<false>(b, r, 32) + (ONE << 10);
+        return divide_q28(-mul_shift<false>(a, q, 30), b);
+    }
+
+    // With t = sqrt(-2 log(p)): x = c(t) / d(t), with c of degree 5 and d of degree 4.
+    // -2 log(p) is at most 2 * 30 * ln(2) as Q.30, so t is calculated as Q.28.
+    const std::int64_t l = mul_shift<false>(-log2_fixed(p, 30), LN2, 31);
+    const std::uint32_t t = static_cast<std::uint32_t>(sqrt_kernel(static_cast<std::uint64_t>(l) << 26));
+    std::int64_t c = -8358966;
+    c = mul_shift<false>(c, t, 28) - 346170561;
+    c = mul_shift<false>(c, t, 28) - 2577794572;
+    c = mul_shift<false>(c, t, 28) - 2737754468;
+    c = mul_shift<false>(c, t, 28) + 4697259855;
+    c = mul_shift<false>(c, t, 28) + 3154829554;
+    std::int64_t d = 8358753;
+    d = mul_shift<false>(d, t, 28) + 346246443;
+    d = mul_shift<false>(d, t, 28) + 2625442788;
+    d = mul_shift<false>(d, t, 28) + 4031265605;
+    d = mul_shift<false>(d, t, 28) + ONE;
+    return divide_q28(c, d);
+}
+
+// Calculates atan(t) for t in [0,1], with both as Q.30.
+//
+// This evaluates a minimax polynomial t * P(t^2) of degree 17, whose absolute error is less than 2^-27.
+// P is evaluated with Estrin's scheme, which needs fewer dependent multiplications than Horner's.
+inline std::int64_t atan_kernel(std::int64_t t) noexcept
+{
+    assert(t >= 0 && t <= (std::int64_t{1} << 30));
+    const std::int64_t u = (t * t) >> 30;
+    const std::int64_t p = poly_estrin<narrow_product, 30, 1073741702, -357906035, 214597040, -152055042, 112731578,
+                                                           -77683696, 42714770, -15463344, 2637889>(u);
+    return (t * p) >> 30;
+}
+
+// Calculates atan(y / x) for y, x >= 0, not both zero, as Q.30, assuming both are less than 2^33.
+// The smaller value is divided by the larger one, so the quotient is in [0,1] and cannot overflow.
+inline std::int64_t atan_quadrant(std::uint64_t y, std::uint64_t x) noexcept
+{
+    constexpr std::int64_t HALF_PI = 1686629713; // pi/2 as Q.30
+    assert(x != 0 || y != 0);
+    const bool steep = y > x;
+    const std::int64_t angle = atan_kernel(static_cast<std::int64_t>(((steep ? x : y) << 30) / (steep ? y : x)));
+    return steep ? HALF_PI - angle : angle;
+}
+
+// Converts radians, as a raw value with F fraction bits, to a binary angle where 2^bits is one full turn.
+//
+// The value is multiplied by 2^64 / (2*pi), shifted right by F bits. The product is the angle in turns as Q0.64,
+// where the overflow discards whole turns exactly. A 32-bit value has at most 31 - F integral bits, so the bits
+// of 1 / (2*pi) beyond the 64-bit constant contribute less than 2^-33 turns, regardless of the magnitude.
+template <bool Round>
+inline std::uint64_t radians_to_turn(std::int64_t value, unsigned int F, unsigned int bits) noexcept
+{
+    assert(F < 64 && bits > 0 && bits <= 32);
+    constexpr std::uint64_t TURNS = 2935890503282001226u;
+    const std::uint64_t turns = static_cast<std::uint64_t>(value) * (TURNS >> F);
+    return (turns + (Round ? std::uint64_t{1} << (63 - bits) : 0)) >> (64 - bits);
+}
+
+// Calculates the sine and cosine of a binary angle, where 2^32 is a full turn, both as Q.31.
+// The angle is split into a quadrant, the nearest entry of a table of sin(i * pi/128) and a
+// remainder h of at most pi/256 radians. Then sin(x0 + h) = sin(x0)cos(h) + cos(x0)sin(h),
+// where short Taylor series of sin(h) and cos(h) are accurate to 2^-36.
+inline void sincos_turn(std::uint32_t turn, std::int64_t* s, std::int64_t* c) noexcept
+{
+    // sin(i * pi/128) as Q1.31
+    static constexpr std::uint32_t table[65] = {
+        0u, 52701887u, 105372028u, 157978697u, 210490206u, 262874923u, 315101295u, 367137861u,
+        418953276u, 470516330u, 521795963u, 572761285u, 623381598u, 673626408u, 723465451u, 772868706u,
+        821806413u, 870249095u, 918167572u, 965532978u, 1012316784u, 1058490808u, 1104027237u, 1148898640u,
+        1193077991u, 1236538675u, 1279254516u, 1321199781u, 1362349204u, 1402678000u, 1442161874u, 1480777044u,
+        1518500250u, 1555308768u, 1591180426u, 1626093616u, 1660027308u, 1692961062u, 1724875040u, 1755750017u,
+        1785567396u, 1814309216u, 1841958164u, 1868497586u, 1893911494u, 1918184581u, 1941302225u, 1963250501u,
+        1984016189u, 2003586779u, 2021950484u, 2039096241u, 2055013723u, 2069693342u, 2083126254u, 2095304370u,
+        2106220352u, 2115867626u, 2124240380u, 2131333572u, 2137142927u, 2141664948u, 2144896910u, 2146836866u,
+        2147483648u
+    };
+    constexpr std::int64_t ONE = std::int64_t{1} << 31;
+    constexpr std::uint32_t HALF_PI = 1686629713u;  // pi/2 as Q2.30
+
+    // The angle within the quadrant, as a fraction of a quarter turn in Q0.30
+    const std::uint32_t x = turn & 0x3FFFFFFF;
+    const std::uint32_t i = (x + (1u << 23)) >> 24;
+    const std::int64_t r = static_cast<std::int64_t>(x) - (static_cast<std::int64_t>(i) << 24);
+
+    // The remainder in radians as Q.31, and its sine and cosine
+    const std::int64_t h = r * HALF_PI / (std::int64_t{1} << 29);
+    const std::int64_t h2 = (h * h) >> 31;
+    const std::int64_t sin_h = h - h2 * h / (6 * ONE);
+    const std::int64_t cos_h = ONE - h2 / 2 + ((h2 * h2) >> 31) / 24;
+
+    const std::int64_t s0 = table[i];
+    const std::int64_t c0 = table[64 - i];
+    const std::int64_t sx = (s0 * cos_h + c0 * sin_h + ONE / 2) >> 31;
+    const std::int64_t cx = (c0 * cos_h - s0 * sin_h + ONE / 2) >> 31;
+
+    // Rotate the result by the quadrant
+    const std::uint32_t quadrant = turn >> 30;
+    const std::int64_t u = (quadrant & 1) ? cx : sx;
+    const std::int64_t v = (quadrant & 1) ? sx : cx;
+    *s = (quadrant & 2) ? -u : u;
+    *c = ((quadrant + 1) & 2) ? -v : v;
+}
+
+// Converts a Q.31 value to a fixed-point number
+template <typename B, typename I, unsigned int F, bool R>
+inline void from_q31(std::int64_t value, fixed<B, I, F, R>* result) noexcept
+{
+    static_assert(F <= 31, "FractionBits must not be larger than 31");
+    *result = fixed<B, I, F, R>::from_raw_value(static_cast<B>(shift_right_signed<R>(value, 31 - static_cast<int>(F))));
+}
+
+// Multiplies a value by a raw value t with F fraction bits and shifts the product right by F bits.
+// The magnitude of t must fit in 32 bits, and the result in 64 bits.
+template <bool Round>
+inline std::int64_t mul_fraction(std::int64_t value, std::int64_t t, unsigned int F) noexcept
+{
+    if (F == 0) {
+        // Without fraction bits, t is a whole number and the product isn't shifted
+        return value * t;
+    }
+    return (t < 0) ? mul_shift<Round>(-value, static_cast<std::uint32_t>(-t), static_cast<int>(F))
+                   : mul_shift<Round>(value, static_cast<std::uint32_t>(t), static_cast<int>(F));
+}
+
+// Number of extra fraction bits carried by the intermediate results of interpolations
+constexpr int INTERPOLATION_BITS = 20;
+constexpr std::int64_t INTERPOLATION_SCALE = std::int64_t{1} << INTERPOLATION_BITS;
+
+// The rows of a bilinear interpolation between the raw values v00, v10 (at tx = 1), v01 (at ty = 1) and v11.
+// Evaluating it returns the result with INTERPOLATION_BITS extra fraction bits.
+struct bilinear_cell
+{
+    bilinear_cell(std::int64_t v00, std::int64_t v10, std::int64_t v01, std::int64_t v11) noexcept
+        : r0(v00 * INTERPOLATION_SCALE), d0((v10 - v00) * INTERPOLATION_SCALE)
+        , r1(v01 * INTERPOLATION_SCALE), d1((v11 - v01) * INTERPOLATION_SCALE)
+    {
+    }
+
+    std::int64_t evaluate(std::int64_t tx, std::int64_t ty, unsigned int F) const noexcept
+    {
+        const std::int64_t x0 = r0 + mul_fraction<false>(d0, tx, F);
+        const std::int64_t x1 = r1 + mul_fraction<false>(d1, tx, F);
+        return x0 + mul_fraction<false>(x1 - x0, ty, F);
+    }
+
+    std::int64_t r0, d0, r1, d1;
+};
+
+// The cubic polynomial of a Catmull-Rom spline between the raw values p1 (at t = 0) and p2 (at t = 1),
+// with p0 and p3 as the neighboring points: (2*p1 + (p2 - p0)*t + (2*p0 - 5*p1 + 4*p2 - p3)*t^2 + (3*(p1 - p2) + p3 - p0)*t^3) / 2.
+// Evaluating it returns twice the result with INTERPOLATION_BITS extra fraction bits.
+struct catmull_rom_segment
+{
+    catmull_rom_segment(std::int64_t p0, std::int64_t p1, std::int64_t p2, std::int64_t p3) noexcept
+        : c0(2 * p1 * INTERPOLATION_SCALE), c1((p2 - p0) * INTERPOLATION_SCALE)
+        , c2((2 * p0 - 5 * p1 + 4 * p2 - p3) * INTERPOLATION_SCALE)
+        , c3((3 * (p1 - p2) + p3 - p0) * INTERPOLATION_SCALE)
+    {
+    }
+
+    std::int64_t evaluate(std::int64_t t, unsigned int F) const noexcept
+    {
+        std::int64_t value = c2 + mul_fraction<false>(c3, t, F);
+        value = c1 + mul_fraction<false>(value, t, F);
+        return c0 + mul_fraction<false>(value, t, F);
+    }
+
+    std::int64_t c0, c1, c2, c3;
+};
+
 }
 
+//
+// Polynomials
+//
+
+//! Polynomial with compile-time coefficients, c0 + c1*x + c2*x^2 + ...
+//! The argument is converted to the format of the coefficients, and the intermediate results are not rounded:
+//! only the result is rounded to the fixed-point type. All intermediate values must fit in 64 bits.
+//! \tparam Fixed     the fixed-point type of the argument and the result
+//! \tparam CoeffBits the number of fraction bits of the coefficients and the intermediate results
+//! \tparam Coeffs    the coefficients as raw values with CoeffBits fraction bits, starting with c0
+template <typename Fixed, unsigned int CoeffBits, std::int64_t... Coeffs>
+class poly;
+
+template <typename B, typename I, unsigned int F, bool R, unsigned int CoeffBits, std::int64_t... Coeffs>
+class poly<fixed<B, I, F, R>, CoeffBits, Coeffs...>
+{
+    static_assert(sizeof...(Coeffs) > 0, "A polynomial must have at least one coefficient");
+    static_assert(CoeffBits < 63, "CoeffBits must be less than 63");
+
+    using Fixed = fixed<B, I, F, R>;
+
+    static inline std::int64_t to_coeff(Fixed x) noexcept
+    {
+        return detail::shift_right_signed<false>(x.raw_value(), static_cast<int>(F) - static_cast<int>(CoeffBits));
+    }
+
+    static inline Fixed from_coeff(std::int64_t value) noexcept
+    {
+        return Fixed::from_raw_value(static_cast<B>(detail::shift_right_signed<R>(value, static_cast<int>(CoeffBits) - static_cast<int>(F))));
+    }
+
+public:
+    static constexpr std::size_t degree = sizeof...(Coeffs) - 1;
+
+    // Evaluates the polynomial with Horner's scheme, which needs the fewest multiplications
+    static inline Fixed horner(Fixed x) noexcept
+    {
+        return from_coeff(detail::poly_horner<detail::wide_product, CoeffBits, Coeffs...>(to_coeff(x)));
+    }
+
+    // Evaluates the polynomial with Estrin's scheme, which has the shortest chain of dependent multiplications
+    static inline Fixed estrin(Fixed x) noexcept
+    {
+        return from_coeff(detail::poly_estrin<detail::wide_product, CoeffBits, Coeffs...>(to_coeff(x)));
+    }
+
+    // Evaluates the polynomial with Estrin's scheme from degree 4, and with Horner's scheme below it
+    static inline Fixed evaluate(Fixed x) noexcept
+    {
+        return (degree >= 4) ? estrin(x) : horner(x);
+    }
+
+    inline Fixed operator()(Fixed x) const noexcept
+    {
+        return evaluate(x);
+    }
+};
+
 //
 // Classification methods
 //
@@ -282,7 +1125,8 @@ fixed<B, I, F, R> pow(fixed<B, I, F, R> base, T exp) noexcept
     return result;
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+// For BaseTypes wider than 32 bits, fractional powers are calculated as exp2(log2(base) * exp)
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 fixed<B, I, F, R> pow(fixed<B, I, F, R> base, fixed<B, I, F, R> exp) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
@@ -311,28 +1155,98 @@ fixed<B, I, F, R> pow(fixed<B, I, F, R> base, fixed<B, I, F, R> exp) noexcept
     return exp2(log2(base) * exp);
 }
 
-template <typename B, typename I, unsigned int F, bool R>
-fixed<B, I, F, R> exp(fixed<B, I, F, R> x) noexcept
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+fixed<B, I, F, R> pow(fixed<B, I, F, R> base, fixed<B, I, F, R> exp) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
-    if (x < Fixed(0)) {
-        return 1 / exp(-x);
+
+    if (base == Fixed(0)) {
+        assert(exp > Fixed(0));
+        return Fixed(0);
     }
+
     constexpr auto FRAC = B(1) << F;
-    const B x_int = x.raw_value() / FRAC;
-    x -= x_int;
-    assert(x >= Fixed(0) && x < Fixed(1));
+    if (exp.raw_value() % FRAC == 0 && (exp >= Fixed(0) || base < Fixed(0)))
+    {
+        // Non-negative whole exponents are easier to calculate, and exact if the result is representable.
+        // Negative bases only support whole exponents.
+        return pow(base, exp.raw_value() / FRAC);
+    }
 
-    constexpr auto fA = Fixed::template from_fixed_point<63>( 128239257017632854ll); // 1.3903728105644451e-2
-    constexpr auto fB = Fixed::template from_fixed_point<63>( 320978614890280666ll); // 3.4800571158543038e-2
-    constexpr auto fC = Fixed::template from_fixed_point<63>(1571680799599592947ll); // 1.7040197373796334e-1
-    constexpr auto fD = Fixed::template from_fixed_point<63>(4603349000587966862ll); // 4.9909609871464493e-1
-    constexpr auto fE = Fixed::template from_fixed_point<62>(4612052447974689712ll); // 1.0000794567422495
+    // For negative bases we do not support fractional exponents.
+    // Technically fractions with odd denominators could work,
+    // but that's too much work to figure out.
+    assert(base > Fixed(0));
+    return Fixed::from_raw_value(static_cast<B>(detail::pow_fixed<R>(static_cast<std::uint64_t>(base.raw_value()), detail::pow_exponent(exp.raw_value()), F)));
+}
+
+// Raises every value in [first, last) to the same power and stores the results in d_first.
+// The output range may be the input range.
+template <typename B, typename I, unsigned int F, bool R>
+void pow(const fixed<B, I, F, R>* first, const fixed<B, I, F, R>* last, fixed<B, I, F, R> exp, fixed<B, I, F, R>* d_first) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+
+    constexpr auto FRAC = B(1) << F;
+    if (exp.raw_value() % FRAC == 0 && exp >= Fixed(0))
+    {
+        for (; first != last; ++first, ++d_first)
+        {
+            *d_first = pow(*first, exp.raw_value() / FRAC);
+        }
+        return;
+    }
+
+    // The exponent is split into its magnitude and sign once, for all values
+    const detail::pow_exponent shared_exp(exp.raw_value());
+    for (; first != last; ++first, ++d_first)
+    {
+        if (*first <= Fixed(0))
+        {
+            // Zero and negative bases have their own rules
+            *d_first = pow(*first, exp);
+            continue;
+        }
+        *d_first = Fixed::from_raw_value(static_cast<B>(detail::pow_fixed<R>(static_cast<std::uint64_t>(first->raw_value()), shared_exp, F)));
+    }
+}
+
+// For BaseTypes wider than 32 bits, e^x is calculated with a polynomial in the IntermediateType
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
+fixed<B, I, F, R> exp(fixed<B, I, F, R> x) noexcept
+{
+    using Fixed = fixed<B, I, F, R>;
+    if (x < Fixed(0)) {
+        return 1 / exp(-x);
+    }
+    constexpr auto FRAC = B(1) << F;
+    const B x_int = x.raw_value() / FRAC;
+    x -= x_int;
+    assert(x >= Fixed(0) && x < Fixed(1));
+
+    constexpr auto fA = Fixed::template from_fixed_point<63>( 128239257017632854ll); // 1.3903728105644451e-2
+    constexpr auto fB = Fixed::template from_fixed_point<63>( 320978614890280666ll); // 3.4800571158543038e-2
+    constexpr auto fC = Fixed::template from_fixed_point<63>(1571680799599592947ll); // 1.7040197373796334e-1
+    constexpr auto fD = Fixed::template from_fixed_point<63>(4603349000587966862ll); // 4.9909609871464493e-1
+    constexpr auto fE = Fixed::template from_fixed_point<62>(4612052447974689712ll); // 1.0000794567422495
     constexpr auto fF = Fixed::template from_fixed_point<63>(9223361618412247875ll); // 9.9999887043019773e-1
     return pow(Fixed::e(), x_int) * (((((fA * x + fB) * x + fC) * x + fD) * x + fE) * x + fF);
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+fixed<B, I, F, R> exp(fixed<B, I, F, R> x) noexcept
+{
+    using Fixed = fixed<B, I, F, R>;
+
+    // e^x = 2^(x * log2(e)). The product keeps 31 extra fraction bits, so the range
+    // reduction does not lose precision, and negative arguments need no reciprocal.
+    const std::int64_t t = detail::mul_shift<false>(std::int64_t{x.raw_value()}, detail::LOG2E, 0);
+    return Fixed::from_raw_value(static_cast<B>(detail::exp2_fixed<R>(t, F + 31, F)));
+}
+
+// For BaseTypes wider than 32 bits, 2^x is calculated with a polynomial in the IntermediateType
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 fixed<B, I, F, R> exp2(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
@@ -350,7 +1264,15 @@ fixed<B, I, F, R> exp2(fixed<B, I, F, R> x) noexcept
     constexpr auto fD = Fixed::template from_fixed_point<63>(2214897896212987987ll); // 2.4013971109076949e-1
     constexpr auto fE = Fixed::template from_fixed_point<63>(6393224161192452326ll); // 6.9315475247516736e-1
     constexpr auto fF = Fixed::template from_fixed_point<63>(9223371050976163566ll); // 9.9999989311082668e-1
-    return Fixed(1 << x_int) * (((((fA * x + fB) * x + fC) * x + fD) * x + fE) * x + fF);
+    return Fixed(B{1} << x_int) * (((((fA * x + fB) * x + fC) * x + fD) * x + fE) * x + fF);
+}
+
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+fixed<B, I, F, R> exp2(fixed<B, I, F, R> x) noexcept
+{
+    using Fixed = fixed<B, I, F, R>;
+
+    return Fixed::from_raw_value(static_cast<B>(detail::exp2_fixed<R>(x.raw_value(), F, F)));
 }
 
 template <typename B, typename I, unsigned int F, bool R>
@@ -359,7 +1281,8 @@ fixed<B, I, F, R> expm1(fixed<B, I, F, R> x) noexcept
     return exp(x) - 1;
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+// For BaseTypes wider than 32 bits, log2(x) is calculated with a polynomial in the IntermediateType
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 fixed<B, I, F, R> log2(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
@@ -385,27 +1308,60 @@ fixed<B, I, F, R> log2(fixed<B, I, F, R> x) noexcept
     return Fixed(highest - F) + (((((fA * x + fB) * x + fC) * x + fD) * x + fE) * x + fF);
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+fixed<B, I, F, R> log2(fixed<B, I, F, R> x) noexcept
+{
+    using Fixed = fixed<B, I, F, R>;
+    assert(x > Fixed(0));
+    const std::int64_t l = detail::log2_fixed(static_cast<std::uint64_t>(x.raw_value()), F);
+    return Fixed::from_raw_value(static_cast<B>(detail::shift_right_signed<R>(l, 30 - static_cast<int>(F))));
+}
+
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 fixed<B, I, F, R> log(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
     return log2(x) / log2(Fixed::e());
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+fixed<B, I, F, R> log(fixed<B, I, F, R> x) noexcept
+{
+    using Fixed = fixed<B, I, F, R>;
+    assert(x > Fixed(0));
+
+    // log(x) = log2(x) * ln(2)
+    const std::int64_t l = detail::mul_shift<false>(detail::log2_fixed(static_cast<std::uint64_t>(x.raw_value()), F), detail::LN2, 6);
+    return Fixed::from_raw_value(static_cast<B>(detail::shift_right_signed<R>(l, 56 - static_cast<int>(F))));
+}
+
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 fixed<B, I, F, R> log10(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
     return log2(x) / log2(Fixed(10));
 }
 
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+fixed<B, I, F, R> log10(fixed<B, I, F, R> x) noexcept
+{
+    using Fixed = fixed<B, I, F, R>;
+    assert(x > Fixed(0));
+
+    // log10(x) = log2(x) * log10(2)
+    constexpr std::uint32_t LOG10_2 = 1292913986u; // log10(2) as Q0.32
+    const std::int64_t l = detail::mul_shift<false>(detail::log2_fixed(static_cast<std::uint64_t>(x.raw_value()), F), LOG10_2, 6);
+    return Fixed::from_raw_value(static_cast<B>(detail::shift_right_signed<R>(l, 56 - static_cast<int>(F))));
+}
+
 template <typename B, typename I, unsigned int F, bool R>
 fixed<B, I, F, R> log1p(fixed<B, I, F, R> x) noexcept
 {
     return log(1 + x);
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+// For BaseTypes wider than 32 bits, the cube root is calculated digit by digit in the IntermediateType
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 fixed<B, I, F, R> cbrt(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
@@ -457,7 +1413,29 @@ fixed<B, I, F, R> cbrt(fixed<B, I, F, R> x) noexcept
     return Fixed::from_raw_value(static_cast<B>(res));
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+fixed<B, I, F, R> cbrt(fixed<B, I, F, R> x) noexcept
+{
+    using Fixed = fixed<B, I, F, R>;
+
+    if (x == Fixed(0))
+    {
+        return x;
+    }
+    if (x < Fixed(0))
+    {
+        return -cbrt(-x);
+    }
+    assert(x >= Fixed(0));
+
+    // The raw result is cbrt(raw / 2^F) * 2^F = cbrt(raw * 2^(2F)). To round it, calculate
+    // twice that, floor(cbrt(raw * 2^(2F+3))), and halve it with rounding.
+    const auto res = detail::cbrt_kernel(static_cast<std::uint64_t>(x.raw_value()), 2 * F + (R ? 3 : 0));
+    return Fixed::from_raw_value(static_cast<B>(R ? (res + 1) / 2 : res));
+}
+
+// For BaseTypes wider than 32 bits, the square root is calculated bit by bit in the IntermediateType
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 fixed<B, I, F, R> sqrt(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
@@ -496,18 +1474,102 @@ fixed<B, I, F, R> sqrt(fixed<B, I, F, R> x) noexcept
     return Fixed::from_raw_value(static_cast<B>(res));
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+fixed<B, I, F, R> sqrt(fixed<B, I, F, R> x) noexcept
+{
+    using Fixed = fixed<B, I, F, R>;
+
+    assert(x >= Fixed(0));
+    if (x == Fixed(0))
+    {
+        return x;
+    }
+
+    // The raw result is sqrt(raw / 2^F) * 2^F = sqrt(raw * 2^F)
+    return Fixed::from_raw_value(static_cast<B>(detail::sqrt_kernel(static_cast<std::uint64_t>(x.raw_value()) << F)));
+}
+
+// For BaseTypes wider than 32 bits, the squares are summed in the fixed-point type
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 fixed<B, I, F, R> hypot(fixed<B, I, F, R> x, fixed<B, I, F, R> y) noexcept
 {
-    assert(x != 0 || y != 0);
     return sqrt(x*x + y*y);
 }
 
+// Calculates sqrt(x^2 + y^2), rounded to nearest.
+// The squares are summed in 64 bits, so they cannot overflow. Results that cannot be represented saturate.
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+fixed<B, I, F, R> hypot(fixed<B, I, F, R> x, fixed<B, I, F, R> y) noexcept
+{
+    using Fixed = fixed<B, I, F, R>;
+
+    // The raw result is sqrt(x_raw^2 + y_raw^2), since both arguments have the same scale
+    const std::uint64_t sum = detail::square_magnitude(x.raw_value()) + detail::square_magnitude(y.raw_value());
+    constexpr auto max = static_cast<std::uint64_t>(std::numeric_limits<B>::max());
+    const std::uint64_t raw = (sum >> 62) != 0 ? max : std::min(detail::sqrt_kernel(sum), max);
+    return Fixed::from_raw_value(static_cast<B>(raw));
+}
+
+// Calculates 1/sqrt(x). Before rounding to the fixed-point type, the relative error of the result is less than 2^-29.
+template <typename B, typename I, unsigned int F, bool R>
+fixed<B, I, F, R> rsqrt(fixed<B, I, F, R> x) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    assert(x > Fixed(0));
+
+    // The raw result is 2^F / sqrt(raw / 2^F) = 2^(3F/2) / sqrt(raw).
+    // For odd F, we double the raw value to keep the power of two integral.
+    constexpr unsigned int odd = F % 2;
+    int exponent;
+    const auto y = detail::rsqrt_kernel(static_cast<std::uint64_t>(x.raw_value()) << odd, &exponent);
+    return Fixed::from_raw_value(static_cast<B>(detail::shift_right<R>(y, exponent - static_cast<int>(3 * F + odd) / 2)));
+}
+
+// Scales the 2D vector (x, y) to unit length, assuming it's not the zero vector.
+// Before rounding to the fixed-point type, the relative error of each component is less than 2^-29.
+template <typename B, typename I, unsigned int F, bool R>
+void normalize2(fixed<B, I, F, R>* x, fixed<B, I, F, R>* y) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    assert(x != nullptr && y != nullptr);
+    assert(*x != Fixed(0) || *y != Fixed(0));
+
+    // The sum of the squared raw values is the squared length with 2F fraction bits,
+    // so the raw reciprocal of the length is 2^F / sqrt(sum).
+    int exponent;
+    const auto inv = detail::rsqrt_kernel(
+        detail::square_magnitude(x->raw_value()) + detail::square_magnitude(y->raw_value()), &exponent);
+    *x = Fixed::from_raw_value(detail::mul_shift<R>(x->raw_value(), inv, exponent - static_cast<int>(F)));
+    *y = Fixed::from_raw_value(detail::mul_shift<R>(y->raw_value(), inv, exponent - static_cast<int>(F)));
+}
+
+// Scales the 3D vector (x, y, z) to unit length, assuming it's not the zero vector.
+// Before rounding to the fixed-point type, the relative error of each component is less than 2^-29.
+template <typename B, typename I, unsigned int F, bool R>
+void normalize3(fixed<B, I, F, R>* x, fixed<B, I, F, R>* y, fixed<B, I, F, R>* z) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    assert(x != nullptr && y != nullptr && z != nullptr);
+    assert(*x != Fixed(0) || *y != Fixed(0) || *z != Fixed(0));
+
+    int exponent;
+    const auto inv = detail::rsqrt_kernel(
+        detail::square_magnitude(x->raw_value()) + detail::square_magnitude(y->raw_value()) +
+        detail::square_magnitude(z->raw_value()), &exponent);
+    *x = Fixed::from_raw_value(detail::mul_shift<R>(x->raw_value(), inv, exponent - static_cast<int>(F)));
+    *y = Fixed::from_raw_value(detail::mul_shift<R>(y->raw_value(), inv, exponent - static_cast<int>(F)));
+    *z = Fixed::from_raw_value(detail::mul_shift<R>(z->raw_value(), inv, exponent - static_cast<int>(F)));
+}
+
 //
 // Trigonometry functions
 //
 
-template <typename B, typename I, unsigned int F, bool R>
+// For BaseTypes wider than 32 bits, the sine is approximated by a polynomial in the fixed-point type
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 fixed<B, I, F, R> sin(fixed<B, I, F, R> x) noexcept
 {
     // This sine uses a fifth-order curve-fitting approximation originally
@@ -540,7 +1602,7 @@ fixed<B, I, F, R> sin(fixed<B, I, F, R> x) noexcept
     return sign * x * (Fixed::pi() - x2*(Fixed::two_pi() - 5 - x2*(Fixed::pi() - 3)))/2;
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 inline fixed<B, I, F, R> cos(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
@@ -548,10 +1610,10 @@ inline fixed<B, I, F, R> cos(fixed<B, I, F, R> x) noexcept
         return sin(x - (Fixed::two_pi() - Fixed::half_pi()));
     } else {
         return sin(Fixed::half_pi() + x);
-    }    
+    }
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 inline fixed<B, I, F, R> tan(fixed<B, I, F, R> x) noexcept
 {
     auto cx = cos(x);
@@ -563,6 +1625,68 @@ inline fixed<B, I, F, R> tan(fixed<B, I, F, R> x) noexcept
     return sin(x) / cx;
 }
 
+// The sine, cosine and tangent reduce the argument by multiplying it by an extended-precision 1/(2*pi),
+// which yields a binary angle, and evaluate the sine and cosine of that angle as Q.31. The results are
+// within 1 ULP for arguments of any magnitude and for any number of fraction bits.
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+inline fixed<B, I, F, R> sin(fixed<B, I, F, R> x) noexcept
+{
+    std::int64_t s, c;
+    detail::sincos_turn(static_cast<std::uint32_t>(detail::radians_to_turn<R>(x.raw_value(), F, 32)), &s, &c);
+    fixed<B, I, F, R> result;
+    detail::from_q31(s, &result);
+    return result;
+}
+
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+inline fixed<B, I, F, R> cos(fixed<B, I, F, R> x) noexcept
+{
+    std::int64_t s, c;
+    detail::sincos_turn(static_cast<std::uint32_t>(detail::radians_to_turn<R>(x.raw_value(), F, 32)), &s, &c);
+    fixed<B, I, F, R> result;
+    detail::from_q31(c, &result);
+    return result;
+}
+
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+inline fixed<B, I, F, R> tan(fixed<B, I, F, R> x) noexcept
+{
+    std::int64_t s, c;
+    detail::sincos_turn(static_cast<std::uint32_t>(detail::radians_to_turn<R>(x.raw_value(), F, 32)), &s, &c);
+    assert(c != 0);
+
+    // The truncated Q.31 quotient still holds the rounding bit of the result, unless F is 31
+    const std::int64_t value = detail::shift_right_signed<R>((s * (std::int64_t{1} << 31)) / c, 31 - static_cast<int>(F));
+
+    // Tangent goes to infinity at 90 and -90 degrees.
+    // We can't represent that with fixed-point maths.
+    assert(value >= std::numeric_limits<B>::min() && value <= std::numeric_limits<B>::max());
+    return fixed<B, I, F, R>::from_raw_value(static_cast<B>(value));
+}
+
+// Tag that selected a precise range reduction for sin, cos and tan, e.g. sin(x, fpm::precise_reduction).
+// The default overloads now reduce their arguments precisely as well, so the tag is kept for compatibility.
+struct precise_reduction_t {};
+constexpr precise_reduction_t precise_reduction{};
+
+template <typename B, typename I, unsigned int F, bool R>
+inline fixed<B, I, F, R> sin(fixed<B, I, F, R> x, precise_reduction_t) noexcept
+{
+    return sin(x);
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+inline fixed<B, I, F, R> cos(fixed<B, I, F, R> x, precise_reduction_t) noexcept
+{
+    return cos(x);
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+inline fixed<B, I, F, R> tan(fixed<B, I, F, R> x, precise_reduction_t) noexcept
+{
+    return tan(x);
+}
+
 namespace detail {
 
 // Calculates atan(x) assuming that x is in the range [0,1]
@@ -615,7 +1739,8 @@ fixed<B, I, F, R> atan_div(fixed<B, I, F, R> y, fixed<B, I, F, R> x) noexcept
 
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+// For BaseTypes wider than 32 bits, the inverse functions are approximated by a polynomial in the fixed-point type
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 fixed<B, I, F, R> atan(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
@@ -632,7 +1757,7 @@ fixed<B, I, F, R> atan(fixed<B, I, F, R> x) noexcept
     return detail::atan_sanitized(x);
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 fixed<B, I, F, R> asin(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
@@ -646,7 +1771,7 @@ fixed<B, I, F, R> asin(fixed<B, I, F, R> x) noexcept
     return detail::atan_div(x, sqrt(yy));
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 fixed<B, I, F, R> acos(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
@@ -660,7 +1785,50 @@ fixed<B, I, F, R> acos(fixed<B, I, F, R> x) noexcept
     return Fixed(2)*detail::atan_div(sqrt(yy), Fixed(1) + x);
 }
 
-template <typename B, typename I, unsigned int F, bool R>
+// The inverse functions reduce their arguments to atan(y / x) with y, x >= 0 as Q.30,
+// and round the Q.30 angle to the fixed-point type once.
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+fixed<B, I, F, R> atan(fixed<B, I, F, R> x) noexcept
+{
+    using Fixed = fixed<B, I, F, R>;
+
+    const std::uint64_t ax = static_cast<std::uint64_t>(x.raw_value() < 0 ? -std::int64_t{x.raw_value()} : std::int64_t{x.raw_value()});
+    const std::int64_t angle = detail::atan_quadrant(ax, std::uint64_t{1} << F);
+    const B raw = static_cast<B>(detail::shift_right<R>(static_cast<std::uint64_t>(angle), 30 - static_cast<int>(F)));
+    return Fixed::from_raw_value((x.raw_value() < 0) ? -raw : raw);
+}
+
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+fixed<B, I, F, R> asin(fixed<B, I, F, R> x) noexcept
+{
+    using Fixed = fixed<B, I, F, R>;
+    assert(x >= Fixed(-1) && x <= Fixed(+1));
+
+    // asin(x) = atan(|x| / sqrt(1 - x^2)), with the sign of x. The square root is calculated from Q.60.
+    const std::int64_t ax = detail::to_q30(x.raw_value() < 0 ? -std::int64_t{x.raw_value()} : std::int64_t{x.raw_value()}, F);
+    const std::uint64_t root = detail::sqrt_kernel((std::uint64_t{1} << 60) - static_cast<std::uint64_t>(ax * ax));
+    const std::int64_t angle = detail::atan_quadrant(static_cast<std::uint64_t>(ax), root);
+    const B raw = static_cast<B>(detail::shift_right<R>(static_cast<std::uint64_t>(angle), 30 - static_cast<int>(F)));
+    return Fixed::from_raw_value((x.raw_value() < 0) ? -raw : raw);
+}
+
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+fixed<B, I, F, R> acos(fixed<B, I, F, R> x) noexcept
+{
+    using Fixed = fixed<B, I, F, R>;
+    constexpr std::int64_t PI = 3373259426; // pi as Q.30
+    assert(x >= Fixed(-1) && x <= Fixed(+1));
+
+    // acos(x) = atan(sqrt(1 - x^2) / x), mirrored to (pi/2, pi] for negative x
+    const std::int64_t ax = detail::to_q30(x.raw_value() < 0 ? -std::int64_t{x.raw_value()} : std::int64_t{x.raw_value()}, F);
+    const std::uint64_t root = detail::sqrt_kernel((std::uint64_t{1} << 60) - static_cast<std::uint64_t>(ax * ax));
+    std::int64_t angle = detail::atan_quadrant(root, static_cast<std::uint64_t>(ax));
+    angle = (x.raw_value() < 0) ? PI - angle : angle;
+    return Fixed::from_raw_value(static_cast<B>(detail::shift_right<R>(static_cast<std::uint64_t>(angle), 30 - static_cast<int>(F))));
+}
+
+// For BaseTypes wider than 32 bits, the angle is approximated by a polynomial in the fixed-point type
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_wide<B>* = nullptr>
 fixed<B, I, F, R> atan2(fixed<B, I, F, R> y, fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
@@ -679,6 +1847,440 @@ fixed<B, I, F, R> atan2(fixed<B, I, F, R> y, fixed<B, I, F, R> x) noexcept
     return ret;
 }
 
+template <typename B, typename I, unsigned int F, bool R, detail::enable_if_narrow<B>* = nullptr>
+fixed<B, I, F, R> atan2(fixed<B, I, F, R> y, fixed<B, I, F, R> x) noexcept
+{
+    using Fixed = fixed<B, I, F, R>;
+    constexpr std::int64_t PI = 3373259426; // pi as Q.30
+    assert(x != Fixed(0) || y != Fixed(0));
+
+    // Reduce to the first quadrant, and map the angle back to the quadrant of (x, y)
+    const std::uint64_t ax = static_cast<std::uint64_t>(x.raw_value() < 0 ? -std::int64_t{x.raw_value()} : std::int64_t{x.raw_value()});
+    const std::uint64_t ay = static_cast<std::uint64_t>(y.raw_value() < 0 ? -std::int64_t{y.raw_value()} : std::int64_t{y.raw_value()});
+    std::int64_t angle = detail::atan_quadrant(ay, ax);
+    angle = (x.raw_value() < 0) ? PI - angle : angle;
+    const B raw = static_cast<B>(detail::shift_right<R>(static_cast<std::uint64_t>(angle), 30 - static_cast<int>(F)));
+    return Fixed::from_raw_value((y.raw_value() < 0) ? -raw : raw);
+}
+
+//
+// Hyperbolic functions
+//
+
+template <typename B, typename I, unsigned int F, bool R>
+fixed<B, I, F, R> sinh(fixed<B, I, F, R> x) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+
+    // sinh(x) = (e^|x| - e^-|x|) / 2, with the sign of x. Both exponentials are calculated as Q.30
+    // from the same reduced argument, and the result saturates when it cannot be represented.
+    const bool negative = x.raw_value() < 0;
+    const std::uint64_t t = static_cast<std::uint64_t>(negative ? -std::int64_t{x.raw_value()} : std::int64_t{x.raw_value()}) * detail::LOG2E;
+    if (static_cast<int>(t >> (F + 31)) > std::numeric_limits<B>::digits - static_cast<int>(F))
+    {
+        return negative ? std::numeric_limits<Fixed>::min() : std::numeric_limits<Fixed>::max();
+    }
+    const std::uint64_t ep = detail::exp2_fixed<false>(static_cast<std::int64_t>(t), F + 31, 30);
+    const std::uint64_t en = detail::exp2_fixed<false>(-static_cast<std::int64_t>(t), F + 31, 30);
+    const auto raw = std::min(detail::shift_right<R>(ep - en, 31 - F), static_cast<std::uint64_t>(std::numeric_limits<B>::max()));
+    return Fixed::from_raw_value(negative ? -static_cast<B>(raw) : static_cast<B>(raw));
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+fixed<B, I, F, R> cosh(fixed<B, I, F, R> x) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+
+    // cosh(x) = (e^|x| + e^-|x|) / 2, saturating when it cannot be represented
+    const std::uint64_t t = static_cast<std::uint64_t>(x.raw_value() < 0 ? -std::int64_t{x.raw_value()} : std::int64_t{x.raw_value()}) * detail::LOG2E;
+    if (static_cast<int>(t >> (F + 31)) > std::numeric_limits<B>::digits - static_cast<int>(F))
+    {
+        return std::numeric_limits<Fixed>::max();
+    }
+    const std::uint64_t ep = detail::exp2_fixed<false>(static_cast<std::int64_t>(t), F + 31, 30);
+    const std::uint64_t en = detail::exp2_fixed<false>(-static_cast<std::int64_t>(t), F + 31, 30);
+    const auto raw = std::min(detail::shift_right<R>(ep + en, 31 - F), static_cast<std::uint64_t>(std::numeric_limits<B>::max()));
+    return Fixed::from_raw_value(static_cast<B>(raw));
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+fixed<B, I, F, R> tanh(fixed<B, I, F, R> x) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+
+    // tanh(x) = 2 / (1 + e^-2|x|) - 1, with the sign of x. This tends to 1 without overflow.
+    const bool negative = x.raw_value() < 0;
+    const std::int64_t s = detail::to_q30(negative ? -std::int64_t{x.raw_value()} : std::int64_t{x.raw_value()}, static_cast<int>(F) - 1);
+    const std::uint64_t raw = detail::shift_right<R>(2 * detail::sigmoid_fixed(s) - (std::uint64_t{1} << 30), 30 - F);
+    return Fixed::from_raw_value(negative ? -static_cast<B>(raw) : static_cast<B>(raw));
+}
+
+//
+// Activation functions
+//
+
+// The logistic function, 1 / (1 + e^-x)
+template <typename B, typename I, unsigned int F, bool R>
+fixed<B, I, F, R> sigmoid(fixed<B, I, F, R> x) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    const std::uint64_t raw = detail::shift_right<R>(detail::sigmoid_fixed(detail::to_q30(x.raw_value(), F)), 30 - F);
+    return Fixed::from_raw_value(static_cast<B>(raw));
+}
+
+// The smooth approximation of max(0, x), log(1 + e^x).
+// This is calculated as max(0, x) + log(1 + e^-|x|), which tends to max(0, x) without overflow.
+template <typename B, typename I, unsigned int F, bool R>
+fixed<B, I, F, R> softplus(fixed<B, I, F, R> x) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    const std::int64_t s = detail::to_q30(x.raw_value(), F);
+    const std::uint64_t d = detail::exp_negative(s < 0 ? -s : s);
+    const std::int64_t l = detail::mul_shift<false>(detail::log2_fixed((std::uint64_t{1} << 30) + d, 30), detail::LN2, 32);
+    const std::uint64_t raw = detail::shift_right<R>(static_cast<std::uint64_t>((s > 0 ? s : 0) + l), 30 - F);
+    return Fixed::from_raw_value(static_cast<B>(raw));
+}
+
+// The Gaussian Error Linear Unit, approximated as x / 2 * (1 + tanh(sqrt(2/pi) * (x + 0.044715 * x^3))).
+// Since 1 + tanh(u) = 2 / (1 + e^-2u), this equals x * sigmoid(2 * sqrt(2/pi) * (x + 0.044715 * x^3)).
+template <typename B, typename I, unsigned int F, bool R>
+fixed<B, I, F, R> gelu(fixed<B, I, F, R> x) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+
+    // Beyond |x| = 8, the result is x or 0 to well over 32 bits of precision
+    const std::int64_t raw = x.raw_value();
+    if (raw >= (std::int64_t{8} << F))
+    {
+        return x;
+    }
+    if (raw <= -(std::int64_t{8} << F))
+    {
+        return Fixed(0);
+    }
+
+    constexpr std::uint32_t C = 192049463u;  // 0.044715 as Q0.32
+    constexpr std::uint32_t K = 3426888095u; // 2 * sqrt(2/pi) as Q1.31
+    const std::int64_t x2 = static_cast<std::int64_t>(detail::shift_right<false>(detail::square_magnitude(raw), 2 * static_cast<int>(F) - 30));
+    const std::int64_t w = (std::int64_t{1} << 30) + detail::mul_shift<false>(x2, C, 32);
+    const std::int64_t u = detail::mul_shift<false>(detail::mul_shift<false>(detail::to_q30(raw, F), static_cast<std::uint32_t>(w), 30), K, 31);
+    return Fixed::from_raw_value(detail::mul_shift<R>(x.raw_value(), static_cast<std::uint32_t>(detail::sigmoid_fixed(u)), 30));
+}
+
+//
+// Error functions
+//
+
+template <typename B, typename I, unsigned int F, bool R>
+fixed<B, I, F, R> erf(fixed<B, I, F, R> x) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    const bool negative = x.raw_value() < 0;
+    const std::uint64_t e = detail::erf_kernel(static_cast<std::uint64_t>(detail::to_q30(negative ? -std::int64_t{x.raw_value()} : std::int64_t{x.raw_value()}, F)));
+    const std::uint64_t raw = detail::shift_right<R>(e, 31 - F);
+    return Fixed::from_raw_value(negative ? -static_cast<B>(raw) : static_cast<B>(raw));
+}
+
+// The complementary error function, 1 - erf(x)
+template <typename B, typename I, unsigned int F, bool R>
+fixed<B, I, F, R> erfc(fixed<B, I, F, R> x) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    const bool negative = x.raw_value() < 0;
+    const std::uint64_t e = detail::erf_kernel(static_cast<std::uint64_t>(detail::to_q30(negative ? -std::int64_t{x.raw_value()} : std::int64_t{x.raw_value()}, F)));
+    const std::uint64_t one = std::uint64_t{1} << 31;
+    return Fixed::from_raw_value(static_cast<B>(detail::shift_right<R>(negative ? one + e : one - e, 31 - F)));
+}
+
+// The cumulative distribution function of the standard normal distribution, (1 + erf(x / sqrt(2))) / 2
+template <typename B, typename I, unsigned int F, bool R>
+fixed<B, I, F, R> normal_cdf(fixed<B, I, F, R> x) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    constexpr std::uint32_t SQRT1_2 = 3037000500u; // 1/sqrt(2) as Q0.32
+    const bool negative = x.raw_value() < 0;
+    const std::int64_t s = detail::to_q30(negative ? -std::int64_t{x.raw_value()} : std::int64_t{x.raw_value()}, F);
+    const std::uint64_t e = detail::erf_kernel(static_cast<std::uint64_t>(detail::mul_shift<false>(s, SQRT1_2, 32)));
+    const std::uint64_t one = std::uint64_t{1} << 31;
+    return Fixed::from_raw_value(static_cast<B>(detail::shift_right<R>(negative ? one - e : one + e, 32 - F)));
+}
+
+// The inverse of normal_cdf, also known as the probit function. p must lie in (0, 1).
+// The result is symmetrical around p = 1/2, where it is zero.
+template <typename B, typename I, unsigned int F, bool R>
+fixed<B, I, F, R> probit(fixed<B, I, F, R> p) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    const std::int64_t one = std::int64_t{1} << F;
+    assert(p.raw_value() > 0 && p.raw_value() < one);
+
+    const bool upper = 2 * std::int64_t{p.raw_value()} > one;
+    const std::int64_t q = upper ? one - p.raw_value() : p.raw_value();
+    const std::int64_t x = detail::shift_right_signed<R>(detail::probit_kernel(static_cast<std::uint64_t>(detail::to_q30(q, F))), 28 - static_cast<int>(F));
+    return Fixed::from_raw_value(static_cast<B>(upper ? -x : x));
+}
+
+//
+// Interpolation functions
+//
+// These are evaluated with extra fraction bits and round only the final result.
+// The interpolation parameters are raw values, whose magnitude must fit in 32 bits.
+//
+
+// Linear interpolation, a + (b - a) * t. This is exact for t = 0 and t = 1, and b - a can't overflow.
+template <typename B, typename I, unsigned int F, bool R>
+inline fixed<B, I, F, R> lerp(fixed<B, I, F, R> a, fixed<B, I, F, R> b, fixed<B, I, F, R> t) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    const std::int64_t d = std::int64_t{b.raw_value()} - a.raw_value();
+    return Fixed::from_raw_value(static_cast<B>(a.raw_value() + detail::mul_fraction<R>(d, t.raw_value(), F)));
+}
+
+// The inverse of linear interpolation, (x - a) / (b - a), so that lerp(a, b, inverse_lerp(a, b, x)) ~= x
+template <typename B, typename I, unsigned int F, bool R>
+inline fixed<B, I, F, R> inverse_lerp(fixed<B, I, F, R> a, fixed<B, I, F, R> b, fixed<B, I, F, R> x) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    assert(a != b);
+
+    // Divide the differences with one extra bit, to round the last bit of the result.
+    // The remainders are scaled in two steps of at most 16 bits, so they cannot overflow, and
+    // the truncated quotients of each step add up to the truncated quotient of the whole.
+    constexpr int HIGH = static_cast<int>(F + 1) / 2;
+    constexpr int LOW = static_cast<int>(F + 1) - HIGH;
+    const std::int64_t num = std::int64_t{x.raw_value()} - a.raw_value();
+    const std::int64_t den = std::int64_t{b.raw_value()} - a.raw_value();
+    const std::int64_t r0 = (num % den) * (std::int64_t{1} << HIGH);
+    const std::int64_t r1 = (r0 % den) * (std::int64_t{1} << LOW);
+    const std::int64_t value = ((num / den) * (std::int64_t{1} << HIGH) + r0 / den) * (std::int64_t{1} << LOW) + r1 / den;
+    return Fixed::from_raw_value(static_cast<B>(R ? (value / 2) + (value % 2) : value / 2));
+}
+
+// Hermite interpolation between 0 and 1 when edge0 < x < edge1, with t = (x - edge0) / (edge1 - edge0) as t^2 * (3 - 2t)
+template <typename B, typename I, unsigned int F, bool R>
+inline fixed<B, I, F, R> smoothstep(fixed<B, I, F, R> edge0, fixed<B, I, F, R> edge1, fixed<B, I, F, R> x) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    assert(edge0 != edge1);
+
+    // t as Q.30, clamped to [0,1]
+    constexpr std::int64_t ONE = std::int64_t{1} << 30;
+    const std::int64_t num = std::int64_t{x.raw_value()} - edge0.raw_value();
+    const std::int64_t den = std::int64_t{edge1.raw_value()} - edge0.raw_value();
+    const std::int64_t t = std::min(std::max((num * ONE) / den, std::int64_t{0}), ONE);
+
+    const std::int64_t t2 = (t * t) >> 30;
+    const std::uint64_t value = static_cast<std::uint64_t>((t2 * (3 * ONE - 2 * t)) >> 30);
+    return Fixed::from_raw_value(static_cast<B>(detail::shift_right<R>(value, 30 - static_cast<int>(F))));
+}
+
+// Bilinear interpolation between v00 (at tx = ty = 0), v10 (at tx = 1), v01 (at ty = 1) and v11.
+template <typename B, typename I, unsigned int F, bool R>
+inline fixed<B, I, F, R> bilinear(fixed<B, I, F, R> v00, fixed<B, I, F, R> v10, fixed<B, I, F, R> v01, fixed<B, I, F, R> v11,
+                                  fixed<B, I, F, R> tx, fixed<B, I, F, R> ty) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    const detail::bilinear_cell cell(v00.raw_value(), v10.raw_value(), v01.raw_value(), v11.raw_value());
+    const std::int64_t value = cell.evaluate(tx.raw_value(), ty.raw_value(), F);
+    return Fixed::from_raw_value(static_cast<B>(detail::shift_right_signed<R>(value, detail::INTERPOLATION_BITS)));
+}
+
+// Catmull-Rom spline interpolation between p1 (at t = 0) and p2 (at t = 1), with p0 and p3 as the neighboring points.
+template <typename B, typename I, unsigned int F, bool R>
+inline fixed<B, I, F, R> catmull_rom(fixed<B, I, F, R> p0, fixed<B, I, F, R> p1, fixed<B, I, F, R> p2, fixed<B, I, F, R> p3,
+                                     fixed<B, I, F, R> t) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    const detail::catmull_rom_segment segment(p0.raw_value(), p1.raw_value(), p2.raw_value(), p3.raw_value());
+    const std::int64_t value = segment.evaluate(t.raw_value(), F);
+    return Fixed::from_raw_value(static_cast<B>(detail::shift_right_signed<R>(value, detail::INTERPOLATION_BITS + 1)));
+}
+
+//
+// Approximations
+//
+// The functions in the `fast` namespace trade accuracy for speed. Their error bounds are documented
+// for the exact real-valued arguments, and exclude the final rounding to the fixed-point type.
+//
+
+namespace fast {
+
+// Approximates sqrt(x^2 + y^2) as alpha * max(|x|,|y|) + beta * min(|x|,|y|).
+// The coefficients minimize the largest relative error, which is 3.96% in either direction.
+// Results that cannot be represented saturate.
+template <typename B, typename I, unsigned int F, bool R>
+fixed<B, I, F, R> hypot(fixed<B, I, F, R> x, fixed<B, I, F, R> y) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    constexpr std::uint64_t ALPHA = 4125032062u; // 0.960433870 as Q0.32
+    constexpr std::uint64_t BETA = 1708644225u;  // 0.397824735 as Q0.32
+
+    const std::uint64_t ax = static_cast<std::uint64_t>(x.raw_value() < 0 ? -std::int64_t{x.raw_value()} : std::int64_t{x.raw_value()});
+    const std::uint64_t ay = static_cast<std::uint64_t>(y.raw_value() < 0 ? -std::int64_t{y.raw_value()} : std::int64_t{y.raw_value()});
+    const std::uint64_t raw = detail::shift_right<R>(std::max(ax, ay) * ALPHA + std::min(ax, ay) * BETA, 32);
+    return Fixed::from_raw_value(static_cast<B>(std::min(raw, static_cast<std::uint64_t>(std::numeric_limits<B>::max()))));
+}
+
+// Approximates sqrt(x^2 + y^2) as the distance to the regular octagon max(|x|, |y|, (|x| + |y|) / sqrt(2)).
+// The result is never larger than the exact distance, and at most 7.61% smaller. This makes it suitable
+// for conservative tests: if hypot_octagonal(x, y) > r, the point (x, y) lies outside the circle of radius r.
+// Results that cannot be represented saturate.
+template <typename B, typename I, unsigned int F, bool R>
+fixed<B, I, F, R> hypot_octagonal(fixed<B, I, F, R> x, fixed<B, I, F, R> y) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    constexpr std::uint64_t SQRT1_2 = 3037000499u; // 1/sqrt(2) as Q0.32, rounded down
+
+    const std::uint64_t ax = static_cast<std::uint64_t>(x.raw_value() < 0 ? -std::int64_t{x.raw_value()} : std::int64_t{x.raw_value()});
+    const std::uint64_t ay = static_cast<std::uint64_t>(y.raw_value() < 0 ? -std::int64_t{y.raw_value()} : std::int64_t{y.raw_value()});
+    const std::uint64_t raw = std::max(std::max(ax, ay), ((ax + ay) * SQRT1_2) >> 32);
+    return Fixed::from_raw_value(static_cast<B>(std::min(raw, static_cast<std::uint64_t>(std::numeric_limits<B>::max()))));
+}
+
+}
+
+//
+// Batch functions
+//
+// These apply a function to every value in [first, last) and store the results in d_first.
+// The output range may be the input range.
+//
+
+// Interpolates between [first_a, last_a) and the range at first_b with a shared t, e.g. to blend two poses.
+template <typename B, typename I, unsigned int F, bool R>
+void lerp(const fixed<B, I, F, R>* first_a, const fixed<B, I, F, R>* last_a, const fixed<B, I, F, R>* first_b,
+          fixed<B, I, F, R> t, fixed<B, I, F, R>* d_first) noexcept
+{
+    for (; first_a != last_a; ++first_a, ++first_b, ++d_first)
+    {
+        *d_first = lerp(*first_a, *first_b, t);
+    }
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+void inverse_lerp(fixed<B, I, F, R> a, fixed<B, I, F, R> b,
+                  const fixed<B, I, F, R>* first, const fixed<B, I, F, R>* last, fixed<B, I, F, R>* d_first) noexcept
+{
+    for (; first != last; ++first, ++d_first)
+    {
+        *d_first = inverse_lerp(a, b, *first);
+    }
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+void smoothstep(fixed<B, I, F, R> edge0, fixed<B, I, F, R> edge1,
+                const fixed<B, I, F, R>* first, const fixed<B, I, F, R>* last, fixed<B, I, F, R>* d_first) noexcept
+{
+    for (; first != last; ++first, ++d_first)
+    {
+        *d_first = smoothstep(edge0, edge1, *first);
+    }
+}
+
+// Interpolates within one cell at the points given by [first_x, last_x) and the range at first_y, e.g. to sample a texel.
+// The rows of the cell are prepared once, for all points.
+template <typename B, typename I, unsigned int F, bool R>
+void bilinear(fixed<B, I, F, R> v00, fixed<B, I, F, R> v10, fixed<B, I, F, R> v01, fixed<B, I, F, R> v11,
+              const fixed<B, I, F, R>* first_x, const fixed<B, I, F, R>* last_x, const fixed<B, I, F, R>* first_y,
+              fixed<B, I, F, R>* d_first) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    const detail::bilinear_cell cell(v00.raw_value(), v10.raw_value(), v01.raw_value(), v11.raw_value());
+    for (; first_x != last_x; ++first_x, ++first_y, ++d_first)
+    {
+        const std::int64_t value = cell.evaluate(first_x->raw_value(), first_y->raw_value(), F);
+        *d_first = Fixed::from_raw_value(static_cast<B>(detail::shift_right_signed<R>(value, detail::INTERPOLATION_BITS)));
+    }
+}
+
+// Evaluates one spline segment at every t in [first, last), e.g. to tessellate a curve.
+// The polynomial of the segment is prepared once, for all values.
+template <typename B, typename I, unsigned int F, bool R>
+void catmull_rom(fixed<B, I, F, R> p0, fixed<B, I, F, R> p1, fixed<B, I, F, R> p2, fixed<B, I, F, R> p3,
+                 const fixed<B, I, F, R>* first, const fixed<B, I, F, R>* last, fixed<B, I, F, R>* d_first) noexcept
+{
+    static_assert(detail::is_narrow<B>::value, "BaseType must not be larger than 32 bits");
+    using Fixed = fixed<B, I, F, R>;
+    const detail::catmull_rom_segment segment(p0.raw_value(), p1.raw_value(), p2.raw_value(), p3.raw_value());
+    for (; first != last; ++first, ++d_first)
+    {
+        const std::int64_t value = segment.evaluate(first->raw_value(), F);
+        *d_first = Fixed::from_raw_value(static_cast<B>(detail::shift_right_signed<R>(value, detail::INTERPOLATION_BITS + 1)));
+    }
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+void sinh(const fixed<B, I, F, R>* first, const fixed<B, I, F, R>* last, fixed<B, I, F, R>* d_first) noexcept
+{
+    for (; first != last; ++first, ++d_first)
+    {
+        *d_first = sinh(*first);
+    }
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+void cosh(const fixed<B, I, F, R>* first, const fixed<B, I, F, R>* last, fixed<B, I, F, R>* d_first) noexcept
+{
+    for (; first != last; ++first, ++d_first)
+    {
+        *d_first = cosh(*first);
+    }
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+void tanh(const fixed<B, I, F, R>* first, const fixed<B, I, F, R>* last, fixed<B, I, F, R>* d_first) noexcept
+{
+    for (; first != last; ++first, ++d_first)
+    {
+        *d_first = tanh(*first);
+    }
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+void sigmoid(const fixed<B, I, F, R>* first, const fixed<B, I, F, R>* last, fixed<B, I, F, R>* d_first) noexcept
+{
+    for (; first != last; ++first, ++d_first)
+    {
+        *d_first = sigmoid(*first);
+    }
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+void softplus(const fixed<B, I, F, R>* first, const fixed<B, I, F, R>* last, fixed<B, I, F, R>* d_first) noexcept
+{
+    for (; first != last; ++first, ++d_first)
+    {
+        *d_first = softplus(*first);
+    }
+}
+
+template <typename B, typename I, unsigned int F, bool R>
+void gelu(const fixed<B, I, F, R>* first, const fixed<B, I, F, R>* last, fixed<B, I, F, R>* d_first) noexcept
+{
+    for (; first != last; ++first, ++d_first)
+    {
+        *d_first = gelu(*first);
+    }
+}
+
 }
 
 #endif
@@ -0,0 +1,120 @@
+#include "common.hpp"
+#include <fpm/math.hpp>
+#include <vector>
+
+namespace
+{
+double gelu_real(double x)
+{
+    const double PI = std::acos(-1);
+    return x / 2 * (1 + std::tanh(std::sqrt(2 / PI) * (x + 0.044715 * x * x * x)));
+}
+}
+
+TEST(activation, sigmoid)
+{
+    // For several values and formats, verify that fpm::sigmoid is close to the logistic function.
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    // Step by PI/1000 to get an irregular pattern
+    for (double value = -20; value <= 20; value += 0.003141593)
+    {
+        const auto x16 = P16(value);
+        EXPECT_NEAR(1 / (1 + std::exp(-static_cast<double>(x16))), static_cast<double>(sigmoid(x16)), ULP16);
+
+        const auto x24 = P24(value);
+        EXPECT_NEAR(1 / (1 + std::exp(-static_cast<double>(x24))), static_cast<double>(sigmoid(x24)), ULP24);
+    }
+
+    // Saturation
+    EXPECT_EQ(P16(0.5), sigmoid(P16(0)));
+    EXPECT_EQ(P16(1), sigmoid(std::numeric_limits<P16>::max()));
+    EXPECT_EQ(P16(0), sigmoid(std::numeric_limits<P16>::min()));
+}
+
+TEST(activation, softplus)
+{
+    // For several values and formats, verify that fpm::softplus is close to log(1 + e^x).
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    // Step by PI/1000 to get an irregular pattern
+    for (double value = -20; value <= 20; value += 0.003141593)
+    {
+        const auto x16 = P16(value);
+        EXPECT_NEAR(std::log1p(std::exp(static_cast<double>(x16))), static_cast<double>(softplus(x16)), ULP16);
+
+        const auto x24 = P24(value);
+        EXPECT_NEAR(std::log1p(std::exp(static_cast<double>(x24))), static_cast<double>(softplus(x24)), ULP24);
+    }
+
+    // Saturation: large values don't overflow
+    constexpr auto max = std::numeric_limits<P16>::max();
+    EXPECT_EQ(max, softplus(max));
+    EXPECT_EQ(P16(0), softplus(std::numeric_limits<P16>::min()));
+}
+
+TEST(activation, gelu)
+{
+    // For several values and formats, verify that fpm::gelu is close to the tanh approximation of GELU.
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    // Step by PI/1000 to get an irregular pattern
+    for (double value = -20; value <= 20; value += 0.003141593)
+    {
+        const auto x16 = P16(value);
+        EXPECT_NEAR(gelu_real(static_cast<double>(x16)), static_cast<double>(gelu(x16)), ULP16);
+
+        const auto x24 = P24(value);
+        EXPECT_NEAR(gelu_real(static_cast<double>(x24)), static_cast<double>(gelu(x24)), ULP24);
+    }
+
+    // Saturation
+    constexpr auto max = std::numeric_limits<P16>::max();
+    EXPECT_EQ(max, gelu(max));
+    EXPECT_EQ(P16(0), gelu(std::numeric_limits<P16>::min()));
+    EXPECT_EQ(P16(0), gelu(P16(0)));
+}
+
+TEST(activation, batch)
+{
+    // The batch functions give the same results as the scalar functions
+    using P = fpm::fixed_16_16;
+
+    std::vector<P> values;
+    for (double value = -20; value <= 20; value += 0.1)
+    {
+        values.push_back(P(value));
+    }
+
+    std::vector<P> results(values.size());
+    sigmoid(values.data(), values.data() + values.size(), results.data());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(sigmoid(values[i]), results[i]);
+    }
+
+    softplus(values.data(), values.data() + values.size(), results.data());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(softplus(values[i]), results[i]);
+    }
+
+    gelu(values.data(), values.data() + values.size(), results.data());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(gelu(values[i]), results[i]);
+    }
+
+    // In-place
+    gelu(values.data(), values.data() + values.size(), values.data());
+    EXPECT_EQ(results, values);
+}
@@ -0,0 +1,115 @@
+#include "common.hpp"
+#include <fpm/angle.hpp>
+
+TEST(angle, arithmetic)
+{
+    using A = fpm::angle<>;
+
+    // Arithmetic wraps around at a full turn
+    EXPECT_EQ(A::from_raw_value(0), A::half_turn() + A::half_turn());
+    EXPECT_EQ(A::from_raw_value(0), A::quarter_turn() * 4);
+    EXPECT_EQ(A::half_turn() + A::quarter_turn(), A::quarter_turn() * -1);
+    EXPECT_EQ(A::from_raw_value(0xFFFFFFFF), A::from_raw_value(0) - A::from_raw_value(1));
+    EXPECT_EQ(A::half_turn(), -A::half_turn());
+    EXPECT_EQ(A::from_raw_value(0x00000100), -A::from_raw_value(0xFFFFFF00));
+
+    // A phase accumulator returns to its start after a whole number of turns
+    A phase = A::from_raw_value(12345);
+    for (int i = 0; i < 1000; ++i)
+    {
+        phase += A::from_raw_value(0x01000000);
+    }
+    EXPECT_EQ(A::from_raw_value(12345 + (1000 % 256) * 0x01000000u), phase);
+
+    // Smaller storage wraps at its own width
+    using A16 = fpm::angle<std::uint16_t>;
+    EXPECT_EQ(A16::from_raw_value(0), A16::half_turn() * 2);
+    EXPECT_EQ(A16::from_raw_value(0x0010), A16::from_raw_value(0xFFF0) + A16::from_raw_value(0x0020));
+    EXPECT_EQ(A16::from_raw_value(0x1234), A16(A::from_raw_value(0x12345678)));
+    EXPECT_EQ(A::from_raw_value(0x12340000), A(A16::from_raw_value(0x1234)));
+}
+
+TEST(angle, radians)
+{
+    using A = fpm::angle<>;
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const double PI = std::acos(-1);
+
+    using A16 = fpm::angle<std::uint16_t>;
+
+    // The fixed-point constants are not exact, but round to exact angles at a lower resolution
+    EXPECT_EQ(A::from_raw_value(0), A(P16(0)));
+    EXPECT_EQ(A16::half_turn(), A16(P24::pi()));
+    EXPECT_EQ(A16::quarter_turn(), A16(P24::half_pi()));
+    EXPECT_EQ(-A16::quarter_turn(), A16(-P24::half_pi()));
+    EXPECT_EQ(A16::from_raw_value(0), A16(P16::two_pi() * 10));
+    EXPECT_EQ(P16(0), static_cast<P16>(A::from_raw_value(0)));
+    EXPECT_EQ(-P16::pi(), static_cast<P16>(A::half_turn()));
+    EXPECT_EQ(P16::half_pi(), static_cast<P16>(A::quarter_turn()));
+
+    // Whole turns are discarded, even far outside [-pi, pi]
+    for (double value = -100; value <= 100; value += 0.0314159)
+    {
+        const auto x16 = P16(value);
+        const double turns = static_cast<double>(x16) / (2 * PI);
+        const double expected = (turns - std::floor(turns)) * 4294967296.0;
+        const auto actual = A(x16).raw_value();
+        EXPECT_LE(std::abs(static_cast<double>(static_cast<std::int32_t>(actual - static_cast<std::uint32_t>(std::llround(expected) & 0xFFFFFFFF)))), 1);
+    }
+
+    // Converting back to radians gives the signed angle
+    for (std::uint32_t raw = 0; raw < 0xFFFF0000; raw += 0x00FF1234)
+    {
+        const auto a = A::from_raw_value(raw);
+        const double expected = static_cast<std::int32_t>(raw) * PI / 2147483648.0;
+        EXPECT_NEAR(expected, static_cast<double>(static_cast<P16>(a)), static_cast<double>(std::numeric_limits<P16>::epsilon()));
+        EXPECT_NEAR(expected, static_cast<double>(static_cast<P24>(a)), static_cast<double>(std::numeric_limits<P24>::epsilon()));
+    }
+}
+
+TEST(angle, sincos)
+{
+    // For many angles and formats, verify that sin and cos are within 1 ULP of their std counterparts.
+    using A = fpm::angle<>;
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const double PI = std::acos(-1);
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    for (std::uint32_t raw = 0; raw < 0xFFFF0000; raw += 0x0001F3A7)
+    {
+        const auto a = A::from_raw_value(raw);
+        const double x = raw * (2 * PI / 4294967296.0);
+        EXPECT_NEAR(std::sin(x), static_cast<double>(fpm::sin<P16>(a)), ULP16);
+        EXPECT_NEAR(std::cos(x), static_cast<double>(fpm::cos<P16>(a)), ULP16);
+        EXPECT_NEAR(std::sin(x), static_cast<double>(fpm::sin<P24>(a)), ULP24);
+        EXPECT_NEAR(std::cos(x), static_cast<double>(fpm::cos<P24>(a)), ULP24);
+
+        P24 s, c;
+        fpm::sincos(a, &s, &c);
+        EXPECT_EQ(fpm::sin<P24>(a), s);
+        EXPECT_EQ(fpm::cos<P24>(a), c);
+    }
+
+    // Quadrant boundaries are exact
+    EXPECT_EQ(P16(0), fpm::sin<P16>(A::from_raw_value(0)));
+    EXPECT_EQ(P16(1), fpm::cos<P16>(A::from_raw_value(0)));
+    EXPECT_EQ(P16(1), fpm::sin<P16>(A::quarter_turn()));
+    EXPECT_EQ(P16(0), fpm::cos<P16>(A::quarter_turn()));
+    EXPECT_EQ(P16(0), fpm::sin<P16>(A::half_turn()));
+    EXPECT_EQ(P16(-1), fpm::cos<P16>(A::half_turn()));
+    EXPECT_EQ(P16(-1), fpm::sin<P16>(-A::quarter_turn()));
+    EXPECT_EQ(P16(0), fpm::cos<P16>(-A::quarter_turn()));
+
+    // Smaller storage uses the same kernel
+    using A16 = fpm::angle<std::uint16_t>;
+    for (std::uint32_t raw = 0; raw < 0x10000; raw += 0x89)
+    {
+        const auto a = A16::from_raw_value(static_cast<std::uint16_t>(raw));
+        const double x = raw * (2 * PI / 65536.0);
+        EXPECT_NEAR(std::sin(x), static_cast<double>(fpm::sin<P16>(a)), ULP16);
+        EXPECT_NEAR(std::cos(x), static_cast<double>(fpm::cos<P16>(a)), ULP16);
+    }
+}
@@ -0,0 +1,198 @@
+#include "common.hpp"
+#include <fpm/binary.hpp>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // Every test uses a file of its own, so the tests can run in parallel
+    std::string test_path()
+    {
+        return std::string("fpm_binary_") + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin";
+    }
+
+    template <typename T>
+    std::vector<T> make_values(int count)
+    {
+        std::vector<T> values;
+        for (int i = 0; i < count; ++i)
+        {
+            values.push_back(T(i - count / 2) / 7);
+        }
+        return values;
+    }
+
+    std::vector<unsigned char> read_bytes()
+    {
+        std::vector<unsigned char> bytes;
+        std::FILE* file = std::fopen(test_path().c_str(), "rb");
+        for (int ch; file != nullptr && (ch = std::fgetc(file)) != EOF; )
+        {
+            bytes.push_back(static_cast<unsigned char>(ch));
+        }
+        std::fclose(file);
+        return bytes;
+    }
+
+    void write_bytes(const std::vector<unsigned char>& bytes)
+    {
+        std::FILE* file = std::fopen(test_path().c_str(), "wb");
+        std::fwrite(bytes.data(), 1, bytes.size(), file);
+        std::fclose(file);
+    }
+}
+
+TEST(binary, read_write)
+{
+    const std::string file = test_path();
+    const char* const path = file.c_str();
+    using P = fpm::fixed_16_16;
+
+    const auto values = make_values<P>(1000);
+    ASSERT_EQ(std::errc{}, fpm::binary::write(path, values));
+
+    fpm::binary::format format;
+    ASSERT_EQ(std::errc{}, fpm::binary::read_format(path, format));
+    EXPECT_EQ(4u, format.base_size);
+    EXPECT_TRUE(format.is_signed);
+    EXPECT_EQ(16u, format.fraction_bits);
+    EXPECT_TRUE(format.rounding);
+    EXPECT_EQ(1000u, format.count);
+
+    std::vector<P> result;
+    EXPECT_EQ(std::errc{}, fpm::binary::read(path, result));
+    EXPECT_EQ(values, result);
+
+    // The rounding flag doesn't matter, but the other properties of the format do
+    std::vector<fpm::fixed<std::int32_t, std::int64_t, 16, false>> unrounded;
+    EXPECT_EQ(std::errc{}, fpm::binary::read(path, unrounded));
+    EXPECT_EQ(values[123].raw_value(), unrounded[123].raw_value());
+
+    std::vector<fpm::fixed_24_8> other_fraction;
+    EXPECT_EQ(std::errc::invalid_argument, fpm::binary::read(path, other_fraction));
+    std::vector<fpm::fixed<std::uint32_t, std::uint64_t, 16>> other_sign;
+    EXPECT_EQ(std::errc::invalid_argument, fpm::binary::read(path, other_sign));
+    ASSERT_EQ(std::errc{}, fpm::binary::write(path, make_values<fpm::fixed<std::int16_t, std::int32_t, 8>>(10)));
+    std::vector<fpm::fixed_24_8> other_size;
+    EXPECT_EQ(std::errc::invalid_argument, fpm::binary::read(path, other_size));
+
+    // Without values, also from a null pointer
+    ASSERT_EQ(std::errc{}, fpm::binary::write(path, std::vector<P>()));
+    EXPECT_EQ(std::errc{}, fpm::binary::read(path, result));
+    EXPECT_TRUE(result.empty());
+    ASSERT_EQ(std::errc{}, fpm::binary::write(path, static_cast<const P*>(nullptr), 0));
+    EXPECT_EQ(std::errc{}, fpm::binary::read(path, result));
+    EXPECT_TRUE(result.empty());
+
+    std::remove(path);
+    EXPECT_EQ(std::errc::no_such_file_or_directory, fpm::binary::read(path, result));
+}
+
+TEST(binary, byte_order)
+{
+    const std::string file = test_path();
+    const char* const path = file.c_str();
+    using P = fpm::fixed_16_16;
+
+    // Swap the values and the byte order in the header
+    const auto values = make_values<P>(100);
+    ASSERT_EQ(std::errc{}, fpm::binary::write(path, values));
+    auto bytes = read_bytes();
+    ASSERT_EQ(64u + 400u, bytes.size());
+    bytes[5] ^= 1;
+    for (std::size_t i = 64; i < bytes.size(); i += 4)
+    {
+        std::swap(bytes[i], bytes[i + 3]);
+        std::swap(bytes[i + 1], bytes[i + 2]);
+    }
+    write_bytes(bytes);
+
+    std::vector<P> result;
+    EXPECT_EQ(std::errc{}, fpm::binary::read(path, result));
+    EXPECT_EQ(values, result);
+
+    // A view can't convert the values
+    fpm::binary::view<P> view;
+    EXPECT_EQ(std::errc::invalid_argument, view.open(path));
+    EXPECT_TRUE(view.empty());
+    std::remove(path);
+}
+
+TEST(binary, invalid)
+{
+    const std::string file = test_path();
+    const char* const path = file.c_str();
+    using P = fpm::fixed_16_16;
+
+    ASSERT_EQ(std::errc{}, fpm::binary::write(path, make_values<P>(10)));
+    const auto bytes = read_bytes();
+    std::vector<P> result;
+
+    // Not a binary file, and a file with fewer or more values than its header says
+    auto invalid = bytes;
+    invalid[0] = 'X';
+    write_bytes(invalid);
+    EXPECT_EQ(std::errc::illegal_byte_sequence, fpm::binary::read(path, result));
+
+    invalid = bytes;
+    invalid.pop_back();
+    write_bytes(invalid);
+    EXPECT_EQ(std::errc::illegal_byte_sequence, fpm::binary::read(path, result));
+
+    invalid = bytes;
+    invalid.insert(invalid.end(), 4, 0);
+    write_bytes(invalid);
+    EXPECT_EQ(std::errc::illegal_byte_sequence, fpm::binary::read(path, result));
+
+    write_bytes(std::vector<unsigned char>(bytes.begin(), bytes.begin() + 32));
+    fpm::binary::view<P> view;
+    EXPECT_EQ(std::errc::illegal_byte_sequence, view.open(path));
+    std::remove(path);
+}
+
+TEST(binary, view)
+{
+    const std::string file = test_path();
+    const char* const path = file.c_str();
+    using P = fpm::fixed_8_24;
+
+    const auto values = make_values<P>(100000);
+    ASSERT_EQ(std::errc{}, fpm::binary::write(path, values.data(), values.size()));
+
+    fpm::binary::view<P> view;
+    ASSERT_EQ(std::errc{}, view.open(path));
+    ASSERT_EQ(values.size(), view.size());
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(view.data()) % alignof(P));
+    EXPECT_EQ(values, std::vector<P>(view.begin(), view.end()));
+    EXPECT_EQ(values[4321], view[4321]);
+
+    fpm::binary::view<fpm::fixed_16_16> mismatch;
+    EXPECT_EQ(std::errc::invalid_argument, mismatch.open(path));
+    EXPECT_EQ(nullptr, mismatch.data());
+
+    // Views can be returned from functions and stored in containers
+    const auto open_view = [path]() -> fpm::binary::view<P> {
+        fpm::binary::view<P> opened;
+        EXPECT_EQ(std::errc{}, opened.open(path));
+        return opened;
+    };
+    std::vector<fpm::binary::view<P>> views;
+    views.push_back(open_view());
+    views.push_back(std::move(view));
+    EXPECT_TRUE(view.empty());
+    EXPECT_EQ(nullptr, view.data());
+    for (const auto& moved : views)
+    {
+        EXPECT_EQ(values, std::vector<P>(moved.begin(), moved.end()));
+    }
+
+    view = std::move(views.front());
+    EXPECT_TRUE(views.front().empty());
+    EXPECT_EQ(values[4321], view[4321]);
+    view.close();
+    EXPECT_TRUE(view.empty());
+    std::remove(path);
+}
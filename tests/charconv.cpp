@@ -0,0 +1,297 @@
+#include "common.hpp"
+#include <fpm/charconv.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+    template <typename B, typename I, unsigned int F, bool R>
+    std::string to_string(fpm::fixed<B, I, F, R> value, fpm::chars_format fmt, int precision)
+    {
+        char buffer[128];
+        const auto result = fpm::to_chars(buffer, buffer + sizeof(buffer), value, fmt, precision);
+        EXPECT_EQ(std::errc{}, result.ec);
+        return std::string(buffer, result.ptr);
+    }
+
+    // Writes the value in fixed notation from its exact decimal expansion, without the fast path for small precisions
+    template <typename B, typename I, unsigned int F, bool R>
+    std::string exact_fixed_string(fpm::fixed<B, I, F, R> value, int precision)
+    {
+        char buffer[128];
+        fpm::detail::decimal_digits<F> digits(fpm::detail::magnitude(value.raw_value()));
+        const auto result = fpm::detail::write_fixed(buffer, buffer + sizeof(buffer), value.raw_value() < 0, digits, precision, false);
+        EXPECT_EQ(std::errc{}, result.ec);
+        return std::string(buffer, result.ptr);
+    }
+
+    std::string printf_string(const char* format, int precision, double value)
+    {
+        char buffer[128];
+        const int length = std::snprintf(buffer, sizeof(buffer), format, precision, value);
+        return std::string(buffer, buffer + length);
+    }
+
+    template <typename Fixed>
+    Fixed parse(const std::string& text, fpm::chars_format fmt = fpm::chars_format::general, std::size_t expected_length = std::string::npos)
+    {
+        Fixed value;
+        const auto result = fpm::from_chars(text.data(), text.data() + text.size(), value, fmt);
+        EXPECT_EQ(std::errc{}, result.ec) << "for text: \"" << text << "\"";
+        EXPECT_EQ(expected_length == std::string::npos ? text.size() : expected_length, static_cast<std::size_t>(result.ptr - text.data())) << "for text: \"" << text << "\"";
+        return value;
+    }
+
+    std::errc parse_error(const std::string& text, fpm::chars_format fmt, std::size_t expected_length)
+    {
+        const auto original = fpm::fixed_16_16(123);
+        auto value = original;
+        const auto result = fpm::from_chars(text.data(), text.data() + text.size(), value, fmt);
+        EXPECT_EQ(expected_length, static_cast<std::size_t>(result.ptr - text.data())) << "for text: \"" << text << "\"";
+        EXPECT_EQ(original, value) << "for text: \"" << text << "\"";
+        return result.ec;
+    }
+}
+
+TEST(charconv, to_chars)
+{
+    using P = fpm::fixed_16_16;
+
+    EXPECT_EQ("1.500", to_string(P(1.5), fpm::chars_format::fixed, 3));
+    EXPECT_EQ("-0.2", to_string(P(-0.25), fpm::chars_format::fixed, 1));
+    EXPECT_EQ("0.8", to_string(P(0.75), fpm::chars_format::fixed, 1));
+    EXPECT_EQ("10.0", to_string(P(9.96875), fpm::chars_format::fixed, 1));
+    EXPECT_EQ("-32768.000000", to_string(std::numeric_limits<P>::lowest(), fpm::chars_format::fixed, -1));
+    EXPECT_EQ("1.23e+03", to_string(P(1234.5), fpm::chars_format::scientific, 2));
+    EXPECT_EQ("1e+04", to_string(P(9999.5), fpm::chars_format::scientific, 0));
+    EXPECT_EQ("0.000000e+00", to_string(P(0), fpm::chars_format::scientific, 6));
+    EXPECT_EQ("1.52588e-05", to_string(P::from_raw_value(1), fpm::chars_format::general, 6));
+    EXPECT_EQ("0.5", to_string(P(0.5), fpm::chars_format::general, 6));
+    EXPECT_EQ("0", to_string(P(0), fpm::chars_format::general, 0));
+    EXPECT_EQ("1.23457e+06", to_string(fpm::fixed_24_8(1234567), fpm::chars_format::general, 6));
+    EXPECT_EQ("1.8p+0", to_string(P(1.5), fpm::chars_format::hex, -1));
+    EXPECT_EQ("-1.800p-1", to_string(P(-0.75), fpm::chars_format::hex, 3));
+    EXPECT_EQ("1p+2", to_string(P(3), fpm::chars_format::hex, 0));
+    EXPECT_EQ("0p+0", to_string(P(0), fpm::chars_format::hex, -1));
+
+    // The output does not fit
+    char buffer[4];
+    const auto result = fpm::to_chars(buffer, buffer + sizeof(buffer), P(1.5), fpm::chars_format::fixed, 3);
+    EXPECT_EQ(std::errc::value_too_large, result.ec);
+    EXPECT_EQ(buffer + sizeof(buffer), result.ptr);
+}
+
+TEST(charconv, to_chars_printf)
+{
+    // Every 16.16 value is exactly representable as double, so printf's output is the exact reference
+    using P = fpm::fixed_16_16;
+    for (std::int64_t raw = INT32_MIN; raw <= INT32_MAX; raw += 1234567)
+    {
+        const auto value = P::from_raw_value(static_cast<std::int32_t>(raw));
+        const auto real = static_cast<double>(value);
+        for (int precision : { 0, 1, 3, 6, 17, 25 })
+        {
+            EXPECT_EQ(printf_string("%.*f", precision, real), to_string(value, fpm::chars_format::fixed, precision));
+            EXPECT_EQ(printf_string("%.*e", precision, real), to_string(value, fpm::chars_format::scientific, precision));
+            EXPECT_EQ(printf_string("%.*g", precision, real), to_string(value, fpm::chars_format::general, precision));
+        }
+        EXPECT_EQ(printf_string("%.*a", -1, real).erase(real < 0 ? 1 : 0, 2), to_string(value, fpm::chars_format::hex, -1));
+    }
+}
+
+TEST(charconv, to_chars_fixed_ties)
+{
+    // Values halfway between two results round to even
+    using P = fpm::fixed_16_16;
+    EXPECT_EQ("2", to_string(P(2.5), fpm::chars_format::fixed, 0));
+    EXPECT_EQ("4", to_string(P(3.5), fpm::chars_format::fixed, 0));
+    EXPECT_EQ("-0", to_string(P(-0.5), fpm::chars_format::fixed, 0));
+    EXPECT_EQ("0.12", to_string(P(0.125), fpm::chars_format::fixed, 2));
+    EXPECT_EQ("0.38", to_string(P(0.375), fpm::chars_format::fixed, 2));
+
+    // The odd multiples of 2^-(p+1) are ties at precision p. They are written like printf does.
+    for (int precision = 0; precision <= 9; ++precision)
+    {
+        for (std::int64_t odd = -200001; odd <= 200001; odd += 2 * 9973)
+        {
+            const auto value = P::from_raw_value(static_cast<std::int32_t>(odd << (15 - precision)));
+            EXPECT_EQ(printf_string("%.*f", precision, static_cast<double>(value)), to_string(value, fpm::chars_format::fixed, precision));
+        }
+    }
+
+#if defined(__SIZEOF_INT128__)
+    // Near the largest magnitudes that can be scaled in 64 bits, and for ties with 32 fraction bits,
+    // the result matches the exact expansion
+    using Q = fpm::fixed<std::int64_t, __int128, 32>;
+    for (int precision = 0; precision <= 9; ++precision)
+    {
+        std::uint64_t power = 1;
+        for (int i = 0; i < precision; ++i)
+        {
+            power *= 10;
+        }
+        const auto limit = static_cast<std::int64_t>(std::min<std::uint64_t>(UINT64_MAX / power, INT64_MAX));
+        for (std::int64_t raw : { limit - 1, limit, (limit < INT64_MAX) ? limit + 1 : limit, std::int64_t{246913579} << (31 - precision) })
+        {
+            const auto value = Q::from_raw_value(raw);
+            EXPECT_EQ(exact_fixed_string(value, precision), to_string(value, fpm::chars_format::fixed, precision));
+            EXPECT_EQ(exact_fixed_string(-value, precision), to_string(-value, fpm::chars_format::fixed, precision));
+        }
+    }
+#endif
+}
+
+TEST(charconv, to_chars_fixed_integral)
+{
+    // Magnitudes without fraction bits are written without rounding
+    char buffer[32];
+    fpm::to_chars_result result;
+    ASSERT_TRUE(fpm::detail::write_fixed_scaled<0>(buffer, buffer + sizeof(buffer), false, 12345, 3, &result));
+    EXPECT_EQ("12345.000", std::string(buffer, result.ptr));
+    ASSERT_TRUE(fpm::detail::write_fixed_scaled<0>(buffer, buffer + sizeof(buffer), true, 7, 0, &result));
+    EXPECT_EQ("-7", std::string(buffer, result.ptr));
+    ASSERT_TRUE(fpm::detail::write_fixed_scaled<0>(buffer, buffer + sizeof(buffer), false, UINT64_MAX / 1000000000, 9, &result));
+    EXPECT_EQ(std::to_string(UINT64_MAX / 1000000000) + ".000000000", std::string(buffer, result.ptr));
+    EXPECT_FALSE(fpm::detail::write_fixed_scaled<0>(buffer, buffer + sizeof(buffer), false, UINT64_MAX / 1000000000 + 1, 9, &result));
+}
+
+TEST(charconv, from_chars)
+{
+    using P = fpm::fixed_16_16;
+    using PT = fpm::fixed<std::int32_t, std::int64_t, 16, false>;
+
+    EXPECT_EQ(P(1.5), parse<P>("1.5"));
+    EXPECT_EQ(P(-22.5), parse<P>("-2.25e1"));
+    EXPECT_EQ(P(0.125), parse<P>("1250E-4"));
+    EXPECT_EQ(P(12), parse<P>(".012e3"));
+    EXPECT_EQ(P(100), parse<P>("1e2"));
+    EXPECT_EQ(P(1), parse<P>("1e", fpm::chars_format::general, 1));
+    EXPECT_EQ(P(1), parse<P>("1e+x", fpm::chars_format::general, 1));
+    EXPECT_EQ(P(1), parse<P>("1e5", fpm::chars_format::fixed, 1));
+    EXPECT_EQ(P(7), parse<P>("7.", fpm::chars_format::general));
+    EXPECT_EQ(P(1e-5), parse<P>("1e-5", fpm::chars_format::scientific));
+    EXPECT_EQ(std::numeric_limits<P>::lowest(), parse<P>("-32768"));
+    EXPECT_EQ(std::numeric_limits<P>::max(), parse<P>("32767.99998474121"));
+    EXPECT_EQ(P(0), parse<P>("0.000000000000000000000000000000000000000001e-999999999"));
+    EXPECT_EQ(P(0), parse<P>("-0e999999999"));
+    EXPECT_EQ(P(3), parse<P>("1.8p1", fpm::chars_format::hex));
+    EXPECT_EQ(P(-0.75), parse<P>("-C.0P-4", fpm::chars_format::hex));
+    EXPECT_EQ(P(1), parse<P>("1g", fpm::chars_format::hex, 1));
+    EXPECT_EQ(P(0), parse<P>("0x1p0", fpm::chars_format::hex, 1));
+
+    // Half of the smallest step is rounded away from zero, or truncated, depending on the type
+    EXPECT_EQ(P::from_raw_value(1), parse<P>("0.00000762939453125"));
+    EXPECT_EQ(P::from_raw_value(-1), parse<P>("-0.00000762939453125"));
+    EXPECT_EQ(P::from_raw_value(0), parse<P>("0.00000762939453124999999999999999"));
+    EXPECT_EQ(P::from_raw_value(1), parse<P>("0.8p-16", fpm::chars_format::hex));
+    EXPECT_EQ(PT::from_raw_value(0), parse<PT>("0.00001525878906249"));
+    EXPECT_EQ(PT::from_raw_value(1), parse<PT>("0.00001525878906250"));
+
+    EXPECT_EQ(std::errc::invalid_argument, parse_error("", fpm::chars_format::general, 0));
+    EXPECT_EQ(std::errc::invalid_argument, parse_error("-", fpm::chars_format::general, 0));
+    EXPECT_EQ(std::errc::invalid_argument, parse_error("+1", fpm::chars_format::general, 0));
+    EXPECT_EQ(std::errc::invalid_argument, parse_error(" 1", fpm::chars_format::general, 0));
+    EXPECT_EQ(std::errc::invalid_argument, parse_error(".e1", fpm::chars_format::general, 0));
+    EXPECT_EQ(std::errc::invalid_argument, parse_error("inf", fpm::chars_format::general, 0));
+    EXPECT_EQ(std::errc::invalid_argument, parse_error("1.5", fpm::chars_format::scientific, 0));
+    EXPECT_EQ(std::errc::result_out_of_range, parse_error("32768", fpm::chars_format::general, 5));
+    EXPECT_EQ(std::errc::result_out_of_range, parse_error("-32768.00001", fpm::chars_format::general, 12));
+    EXPECT_EQ(std::errc::result_out_of_range, parse_error("32767.999995 ", fpm::chars_format::general, 12));
+    EXPECT_EQ(std::errc::result_out_of_range, parse_error("1e999999999", fpm::chars_format::general, 11));
+    EXPECT_EQ(std::errc::result_out_of_range, parse_error("1p15", fpm::chars_format::hex, 4));
+}
+
+TEST(charconv, round_trip)
+{
+    // The exact decimal and hexadecimal representations parse back to the same value
+    using P8 = fpm::fixed_24_8;
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    for (std::int64_t raw = INT32_MIN; raw <= INT32_MAX; raw += 6700417)
+    {
+        const auto x8 = P8::from_raw_value(static_cast<std::int32_t>(raw));
+        const auto x16 = P16::from_raw_value(static_cast<std::int32_t>(raw));
+        const auto x24 = P24::from_raw_value(static_cast<std::int32_t>(raw));
+        EXPECT_EQ(x8, parse<P8>(to_string(x8, fpm::chars_format::fixed, 8)));
+        EXPECT_EQ(x16, parse<P16>(to_string(x16, fpm::chars_format::scientific, 20)));
+        EXPECT_EQ(x24, parse<P24>(to_string(x24, fpm::chars_format::fixed, 24)));
+        EXPECT_EQ(x24, parse<P24>(to_string(x24, fpm::chars_format::hex, -1), fpm::chars_format::hex));
+
+        // Fewer digits round to the nearest value, like the conversion from double
+        const auto text = to_string(x16, fpm::chars_format::general, 9);
+        EXPECT_EQ(P16(std::strtod(text.c_str(), nullptr)), parse<P16>(text));
+    }
+}
+
+TEST(charconv, shortest)
+{
+    using P8 = fpm::fixed_24_8;
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    using PT = fpm::fixed<std::int32_t, std::int64_t, 16, false>;
+
+    const auto shortest = [](P16 value, fpm::chars_format fmt) {
+        char buffer[64];
+        const auto result = fpm::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+        EXPECT_EQ(std::errc{}, result.ec);
+        return std::string(buffer, result.ptr);
+    };
+    const auto plain = [](P16 value) {
+        char buffer[64];
+        const auto result = fpm::to_chars(buffer, buffer + sizeof(buffer), value);
+        EXPECT_EQ(std::errc{}, result.ec);
+        return std::string(buffer, result.ptr);
+    };
+
+    EXPECT_EQ("0.1", plain(P16(0.1)));
+    EXPECT_EQ("-1.5", plain(P16(-1.5)));
+    EXPECT_EQ("0", plain(P16(0)));
+    EXPECT_EQ("-32768", plain(std::numeric_limits<P16>::lowest()));
+    EXPECT_EQ("32767.99998", plain(std::numeric_limits<P16>::max()));
+    EXPECT_EQ("2e-05", plain(P16::from_raw_value(1)));
+    EXPECT_EQ("0.00002", shortest(P16::from_raw_value(1), fpm::chars_format::fixed));
+    EXPECT_EQ("2e-05", shortest(P16::from_raw_value(1), fpm::chars_format::general));
+    EXPECT_EQ("1.2e+04", shortest(P16(12000), fpm::chars_format::scientific));
+    EXPECT_EQ("12000", shortest(P16(12000), fpm::chars_format::general));
+    EXPECT_EQ("0.0001", shortest(P16(0.0001), fpm::chars_format::general));
+    EXPECT_EQ("1e-04", plain(P16(0.0001)));
+    EXPECT_EQ("0e+00", shortest(P16(0), fpm::chars_format::scientific));
+    EXPECT_EQ("1.8p+0", shortest(P16(1.5), fpm::chars_format::hex));
+
+    char buffer[16];
+    auto result = fpm::to_chars(buffer, buffer + sizeof(buffer), P8(1200000));
+    EXPECT_EQ("1200000", std::string(buffer, result.ptr));
+    result = fpm::to_chars(buffer, buffer + sizeof(buffer), P8(1200000), fpm::chars_format::general);
+    EXPECT_EQ("1.2e+06", std::string(buffer, result.ptr));
+
+    // Without rounding, the value can't be below the original
+    result = fpm::to_chars(buffer, buffer + sizeof(buffer), P16::from_raw_value(6554));
+    EXPECT_EQ("0.1", std::string(buffer, result.ptr));
+    result = fpm::to_chars(buffer, buffer + sizeof(buffer), PT::from_raw_value(6554));
+    EXPECT_EQ("0.10001", std::string(buffer, result.ptr));
+
+    for (std::int64_t raw = INT32_MIN; raw <= INT32_MAX; raw += 1234567)
+    {
+        const auto x8 = P8::from_raw_value(static_cast<std::int32_t>(raw));
+        const auto x16 = P16::from_raw_value(static_cast<std::int32_t>(raw));
+        const auto x24 = P24::from_raw_value(static_cast<std::int32_t>(raw));
+        const auto xt = PT::from_raw_value(static_cast<std::int32_t>(raw));
+        char text[64];
+        EXPECT_EQ(x8, parse<P8>(std::string(text, fpm::to_chars(text, text + sizeof(text), x8).ptr)));
+        EXPECT_EQ(x24, parse<P24>(std::string(text, fpm::to_chars(text, text + sizeof(text), x24, fpm::chars_format::fixed).ptr)));
+        EXPECT_EQ(xt, parse<PT>(std::string(text, fpm::to_chars(text, text + sizeof(text), xt, fpm::chars_format::general).ptr)));
+
+        // The shortest string round-trips, and one significant digit less does not
+        const auto scientific = shortest(x16, fpm::chars_format::scientific);
+        EXPECT_EQ(x16, parse<P16>(scientific));
+        const auto digits = static_cast<int>(scientific.find('e') - (x16 < P16(0) ? 1 : 0) - (scientific.find('.') == std::string::npos ? 0 : 1));
+        if (digits > 1)
+        {
+            const auto shorter = to_string(x16, fpm::chars_format::scientific, digits - 2);
+            auto value = x16;
+            const auto result = fpm::from_chars(shorter.data(), shorter.data() + shorter.size(), value);
+            EXPECT_TRUE(result.ec != std::errc{} || value != x16) << "for text: \"" << shorter << "\"";
+        }
+    }
+}
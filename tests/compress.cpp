@@ -0,0 +1,128 @@
+#include "common.hpp"
+#include <fpm/compress.hpp>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+    template <typename T>
+    void test_round_trip(const std::vector<T>& values)
+    {
+        const auto data = fpm::compress(values);
+        std::vector<T> result;
+        EXPECT_EQ(std::errc{}, fpm::decompress(data, result));
+        EXPECT_EQ(values, result);
+    }
+
+    // A slowly changing signal with noise, like sensor readings
+    template <typename T>
+    std::vector<T> make_signal(std::size_t count, unsigned int noise)
+    {
+        std::mt19937 gen(12345);
+        std::vector<T> values;
+        auto value = T(10);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            value += T::from_raw_value(static_cast<typename std::make_signed<decltype(value.raw_value())>::type>(i % 7) - 3);
+            values.push_back(value + T::from_raw_value(noise > 0 ? gen() % noise : 0));
+        }
+        return values;
+    }
+}
+
+TEST(compress, round_trip)
+{
+    using P = fpm::fixed_16_16;
+
+    test_round_trip(std::vector<P>());
+    test_round_trip(std::vector<P>{ P(1) });
+    test_round_trip(std::vector<P>{ P(1), P(-1) });
+    test_round_trip(make_signal<P>(1000, 0));
+    test_round_trip(make_signal<P>(1000, 16));
+    test_round_trip(make_signal<P>(127, 1000));
+    test_round_trip(make_signal<P>(129, 1000));
+
+    // Random values and the extremes of the type, whose differences wrap around
+    std::mt19937 gen(54321);
+    std::vector<P> values;
+    for (int i = 0; i < 1000; ++i)
+    {
+        values.push_back(P::from_raw_value(static_cast<std::int32_t>(gen())));
+    }
+    test_round_trip(values);
+    values.assign(300, std::numeric_limits<P>::max());
+    for (std::size_t i = 0; i < values.size(); i += 3)
+    {
+        values[i] = std::numeric_limits<P>::lowest();
+    }
+    test_round_trip(values);
+}
+
+TEST(compress, types)
+{
+    test_round_trip(make_signal<fpm::fixed<std::int8_t, std::int16_t, 4>>(300, 5));
+    test_round_trip(make_signal<fpm::fixed<std::uint16_t, std::uint32_t, 8>>(300, 100));
+    test_round_trip(make_signal<fpm::fixed_8_24>(300, 100000));
+    test_round_trip(make_signal<fpm::fixed<std::uint32_t, std::uint64_t, 16>>(300, 100));
+}
+
+TEST(compress, size)
+{
+    using P = fpm::fixed_16_16;
+
+    // A steady slope needs no bits per value, and small deltas only a few
+    std::vector<P> ramp;
+    for (int i = 0; i < 1280; ++i)
+    {
+        ramp.push_back(P(i) / 4);
+    }
+    EXPECT_LE(fpm::compress(ramp).size(), 10u * 10u);
+    EXPECT_LE(fpm::compress(make_signal<P>(12800, 16)).size(), 12800u * 6u / 8u);
+}
+
+TEST(compress, streaming)
+{
+    using P = fpm::fixed_16_16;
+
+    const auto values = make_signal<P>(1000, 16);
+    std::vector<unsigned char> data;
+    {
+        fpm::compressor<P> compressor(data);
+        compressor.append(values.data(), 300);
+        for (std::size_t i = 300; i < values.size(); ++i)
+        {
+            compressor.append(values[i]);
+        }
+    }
+    EXPECT_EQ(fpm::compress(values), data);
+
+    // Blocks of separate calls can be concatenated
+    std::vector<unsigned char> concatenated;
+    fpm::compress(values.data(), 100, concatenated);
+    fpm::compress(values.data() + 100, values.size() - 100, concatenated);
+    std::vector<P> result;
+    EXPECT_EQ(std::errc{}, fpm::decompress(concatenated, result));
+    EXPECT_EQ(values, result);
+}
+
+TEST(compress, invalid)
+{
+    using P = fpm::fixed_16_16;
+
+    const auto data = fpm::compress(make_signal<P>(200, 1000));
+    for (std::size_t size = 1; size < data.size(); ++size)
+    {
+        // A truncated block is invalid, but its preceding blocks are decompressed
+        std::vector<P> result;
+        const auto ec = fpm::decompress(data.data(), data.data() + size, result);
+        EXPECT_TRUE(ec == std::errc::illegal_byte_sequence || result.size() == 128u);
+        EXPECT_TRUE(result.size() == 0u || result.size() == 128u);
+    }
+
+    // More bits per difference than the type has
+    std::vector<fpm::fixed<std::int16_t, std::int32_t, 8>> result;
+    const unsigned char too_wide[] = { 1, 17, 0, 0, 0, 0 };
+    EXPECT_EQ(std::errc::illegal_byte_sequence, fpm::decompress(std::begin(too_wide), std::end(too_wide), result));
+}
@@ -0,0 +1,267 @@
+#include "common.hpp"
+#include <fpm/csv.hpp>
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    template <typename T>
+    std::vector<T> make_vector(std::initializer_list<double> values)
+    {
+        std::vector<T> result;
+        for (auto value : values)
+        {
+            result.push_back(T(value));
+        }
+        return result;
+    }
+
+    // A stream buffer that takes a limited number of characters
+    class limited_buffer : public std::streambuf
+    {
+    public:
+        explicit limited_buffer(std::size_t capacity) : m_capacity(capacity) {}
+
+        const std::string& str() const { return m_data; }
+
+    protected:
+        std::streamsize xsputn(const char* s, std::streamsize count) override
+        {
+            const auto size = std::min(static_cast<std::size_t>(count), m_capacity - m_data.size());
+            m_data.append(s, size);
+            return static_cast<std::streamsize>(size);
+        }
+
+    private:
+        std::size_t m_capacity;
+        std::string m_data;
+    };
+}
+
+namespace fpm
+{
+    static bool operator==(const csv_error& a, const csv_error& b)
+    {
+        return a.row == b.row && a.column == b.column && a.ec == b.ec;
+    }
+}
+
+TEST(csv, read)
+{
+    using P = fpm::fixed_16_16;
+
+    const std::string text = "time, price ,volume\r\n1.5,2,x\r\n-3,4.25\n5, 6 ,7,8\n9,1e1,100000";
+    fpm::csv_table<P> table;
+    fpm::read_csv(text.data(), text.data() + text.size(), table);
+
+    EXPECT_EQ(4u, table.rows);
+    EXPECT_EQ((std::vector<std::string>{ "time", "price", "volume" }), table.names);
+    ASSERT_EQ(3u, table.columns.size());
+    EXPECT_EQ(make_vector<P>({ 1.5, -3, 5, 9 }), table.columns[0]);
+    EXPECT_EQ(make_vector<P>({ 2, 4.25, 6, 10 }), table.columns[1]);
+    EXPECT_EQ(make_vector<P>({ 0, 0, 7, 0 }), table.columns[2]);
+
+    // A field that isn't a number, a missing field and a number out of range
+    const std::vector<fpm::csv_error> errors {
+        { 0, 2, std::errc::invalid_argument },
+        { 1, 2, std::errc::invalid_argument },
+        { 3, 2, std::errc::result_out_of_range },
+    };
+    EXPECT_EQ(errors, table.errors);
+
+    // Without data
+    fpm::read_csv(text.data(), text.data(), table);
+    EXPECT_EQ(0u, table.rows);
+    EXPECT_TRUE(table.columns.empty());
+}
+
+TEST(csv, options)
+{
+    using P = fpm::fixed_24_8;
+
+    const std::string text = "1;2;3\n4;5;6\n\n7;8;9\n";
+    fpm::csv_options options;
+    options.delimiter = ';';
+    options.header = false;
+    options.columns = { 2, 0 };
+
+    fpm::csv_table<P> table;
+    fpm::read_csv(text.data(), text.data() + text.size(), table, options);
+
+    // An empty line is a row without fields
+    EXPECT_EQ(4u, table.rows);
+    EXPECT_TRUE(table.names.empty());
+    ASSERT_EQ(2u, table.columns.size());
+    EXPECT_EQ(make_vector<P>({ 3, 6, 0, 9 }), table.columns[0]);
+    EXPECT_EQ(make_vector<P>({ 1, 4, 0, 7 }), table.columns[1]);
+    EXPECT_EQ(2u, table.errors.size());
+}
+
+TEST(csv, threads)
+{
+    using P = fpm::fixed_16_16;
+
+    // Enough data for several chunks, with errors spread throughout
+    std::string text = "a,b\n";
+    for (int i = 0; i < 100000; ++i)
+    {
+        text += std::to_string(i % 30000) + "." + std::to_string(i % 7) + ",";
+        text += (i % 1000 == 999) ? "-\n" : std::to_string(-i % 1000) + "\n";
+    }
+
+    fpm::csv_options options;
+    options.threads = 1;
+    fpm::csv_table<P> expected;
+    fpm::read_csv(text.data(), text.data() + text.size(), expected, options);
+    EXPECT_EQ(100000u, expected.rows);
+    EXPECT_EQ(100u, expected.errors.size());
+
+    options.threads = 8;
+    fpm::csv_table<P> table;
+    fpm::read_csv(text.data(), text.data() + text.size(), table, options);
+    EXPECT_EQ(expected.rows, table.rows);
+    EXPECT_EQ(expected.columns, table.columns);
+    EXPECT_EQ(expected.errors, table.errors);
+    EXPECT_EQ(P(12345.4), table.columns[0][12345]);
+    EXPECT_EQ(P(-345), table.columns[1][12345]);
+}
+
+TEST(csv, file)
+{
+    using P = fpm::fixed_16_16;
+
+    const char* const path = "fpm_csv_test.csv";
+    std::FILE* file = std::fopen(path, "wb");
+    ASSERT_NE(nullptr, file);
+    std::fputs("x,y\n0.25,-1\n", file);
+    std::fclose(file);
+
+    fpm::csv_table<P> table;
+    EXPECT_EQ(std::errc{}, fpm::read_csv_file(path, table));
+    std::remove(path);
+    EXPECT_EQ(1u, table.rows);
+    EXPECT_EQ(make_vector<P>({ 0.25 }), table.columns[0]);
+    EXPECT_EQ(make_vector<P>({ -1 }), table.columns[1]);
+
+    EXPECT_EQ(std::errc::no_such_file_or_directory, fpm::read_csv_file(path, table));
+}
+
+TEST(csv, write_row)
+{
+    std::ostringstream os;
+    {
+        fpm::csv_writer writer(os);
+        writer.precision(2);
+        writer.precision(1, -1);
+        writer.precision(3, 0);
+        writer.write_row("a", "b", "c", std::string("d"));
+        writer.write_row(fpm::fixed_16_16(1.5), fpm::fixed_16_16(-0.1), 0.126, fpm::fixed_24_8(2.5));
+        writer.write_row(fpm::fixed_16_16(0), fpm::fixed_16_16(3), -1.0, fpm::fixed_24_8(3.5));
+    }
+    EXPECT_EQ("a,b,c,d\n1.50,-0.1,0.13,2\n0.00,3,-1.00,4\n", os.str());
+
+    // Tabs and the default precision
+    std::ostringstream tsv;
+    {
+        fpm::csv_writer writer(tsv, '\t');
+        writer.write_row(fpm::fixed_16_16(0.25), 0.5, "-");
+    }
+    EXPECT_EQ("0.25\t0.5\t-\n", tsv.str());
+
+    // Columns without a precision of their own use the default precision, even if it's set later
+    std::ostringstream later;
+    {
+        fpm::csv_writer writer(later);
+        writer.precision(2, 0);
+        writer.precision(1);
+        writer.write_row(fpm::fixed_16_16(0.25), fpm::fixed_16_16(1.5), fpm::fixed_16_16(2.5));
+    }
+    EXPECT_EQ("0.2,1.5,2\n", later.str());
+}
+
+TEST(csv, write_failure)
+{
+    // A stream buffer that takes only part of the rows sets the stream's badbit
+    limited_buffer buffer(10);
+    std::ostream os(&buffer);
+    {
+        fpm::csv_writer writer(os);
+        writer.write_row("abc", fpm::fixed_16_16(1.5));
+        writer.flush();
+        EXPECT_TRUE(os.good());
+        writer.write_row("defgh", fpm::fixed_16_16(2));
+        writer.flush();
+        EXPECT_TRUE(os.bad());
+    }
+    EXPECT_EQ("abc,1.5\nde", buffer.str());
+
+    // Writing columns reports the failure as well
+    limited_buffer column_buffer(100);
+    std::ostream column_os(&column_buffer);
+    {
+        fpm::csv_writer writer(column_os);
+        writer.write_columns(std::vector<std::vector<fpm::fixed_16_16>>(2, std::vector<fpm::fixed_16_16>(100)), 1);
+    }
+    EXPECT_TRUE(column_os.bad());
+
+    // A stream without a stream buffer remains bad, without writing
+    std::ostream null_os(nullptr);
+    {
+        fpm::csv_writer writer(null_os);
+        writer.write_row("a", "b");
+    }
+    EXPECT_TRUE(null_os.bad());
+
+    // With exceptions enabled, the failure throws from flush, but not from the destructor
+    limited_buffer throwing_buffer(4);
+    std::ostream throwing_os(&throwing_buffer);
+    throwing_os.exceptions(std::ios::badbit);
+    {
+        fpm::csv_writer writer(throwing_os);
+        writer.write_row("abcdef");
+        EXPECT_THROW(writer.flush(), std::ios_base::failure);
+        writer.write_row("ghijkl");
+    }
+    EXPECT_EQ("abcd", throwing_buffer.str());
+}
+
+TEST(csv, write_columns)
+{
+    using P = fpm::fixed_16_16;
+
+    // Enough rows for several batches
+    std::vector<std::vector<P>> columns(3);
+    for (int i = 0; i < 100000; ++i)
+    {
+        columns[0].push_back(P(i % 30000) / 7);
+        columns[1].push_back(P(-i % 1000));
+        columns[2].push_back(P::from_raw_value(i * 12345));
+    }
+
+    std::ostringstream expected;
+    {
+        fpm::csv_writer writer(expected);
+        writer.precision(0, 3);
+        writer.write_row("a", "b", "c");
+        writer.write_columns(columns, 1);
+    }
+
+    std::ostringstream os;
+    {
+        fpm::csv_writer writer(os);
+        writer.precision(0, 3);
+        writer.write_row("a", "b", "c");
+        writer.write_columns(columns, 8);
+    }
+    EXPECT_EQ(expected.str(), os.str());
+
+    // The shortest representation reads back to the same values
+    const std::string text = os.str();
+    fpm::csv_table<P> table;
+    fpm::read_csv(text.data(), text.data() + text.size(), table);
+    EXPECT_EQ(100000u, table.rows);
+    EXPECT_TRUE(table.errors.empty());
+    EXPECT_EQ(columns[1], table.columns[1]);
+    EXPECT_EQ(columns[2], table.columns[2]);
+}
@@ -11,3 +11,93 @@ TEST(detail, find_highest_bit)
     EXPECT_EQ(28, fpm::detail::find_highest_bit(0x10000000));
     EXPECT_EQ(31, fpm::detail::find_highest_bit(0x80000000));
 }
+
+TEST(detail, log2_fraction)
+{
+    // The table generator is usable at compile time
+    static_assert(fpm::detail::log2_fraction(std::uint64_t{1} << 31, 30) == 0, "log2(1) must be 0");
+    static_assert(fpm::detail::log2_reciprocal_log(0) == 0, "log2(1) must be 0");
+
+    // log2(sqrt(2)) = 1/2, log2(1.5) = 0.5849625007211562
+    EXPECT_NEAR(1 << 29, fpm::detail::log2_fraction(3037000500u, 30), 2);
+    EXPECT_NEAR(0.5849625007211562 * (1 << 30), fpm::detail::log2_fraction(std::uint64_t{3} << 30, 30), 2);
+}
+
+TEST(detail, log2_normalized)
+{
+    // The absolute error of the kernel is less than 2^-28 over the entire domain, including the table edges
+    for (std::uint64_t m = std::uint64_t{1} << 30; m < (std::uint64_t{1} << 31); m += 65521)
+    {
+        const double expected = std::log2(static_cast<double>(m) / (1 << 30)) * (1 << 30);
+        EXPECT_NEAR(expected, static_cast<double>(fpm::detail::log2_normalized(m)), 4) << "m = " << m;
+    }
+    for (std::uint64_t i = 0; i < 128; ++i)
+    {
+        const std::uint64_t m = (std::uint64_t{128} + i) << 23;
+        const double expected = std::log2(static_cast<double>(m) / (1 << 30)) * (1 << 30);
+        EXPECT_NEAR(expected, static_cast<double>(fpm::detail::log2_normalized(m)), 4) << "m = " << m;
+    }
+}
+
+TEST(detail, mul_q)
+{
+    // The product is shifted with rounding towards negative infinity, like an arithmetic shift
+    EXPECT_EQ(6, fpm::detail::mul_q(2, 3, 0));
+    EXPECT_EQ(1, fpm::detail::mul_q(3, 3, 3));
+    EXPECT_EQ(-2, fpm::detail::mul_q(-3, 3, 3));
+    EXPECT_EQ(-2, fpm::detail::mul_q(3, -3, 3));
+    EXPECT_EQ(1, fpm::detail::mul_q(-3, -3, 3));
+
+    // Products beyond 64 bits are not truncated before the shift
+    EXPECT_EQ(std::int64_t{1} << 60, fpm::detail::mul_q(std::int64_t{1} << 60, std::int64_t{1} << 40, 40));
+    EXPECT_EQ(-(std::int64_t{3} << 59), fpm::detail::mul_q(std::int64_t{3} << 50, -(std::int64_t{1} << 49), 40));
+    EXPECT_EQ(INT64_MAX - 1, fpm::detail::mul_q(INT64_MAX, INT64_MAX, 63));
+    EXPECT_EQ(INT64_MIN + 1, fpm::detail::mul_q(INT64_MIN, INT64_MAX, 63));
+
+#if defined(__SIZEOF_INT128__)
+    // The split product matches the native 128-bit product
+    std::uint64_t state = 0x9E3779B97F4A7C15u;
+    for (int i = 0; i < 10000; ++i)
+    {
+        state = state * 6364136223846793005u + 1442695040888963407u;
+        const auto a = static_cast<std::int64_t>(state) >> (i % 40);
+        state = state * 6364136223846793005u + 1442695040888963407u;
+        const auto b = static_cast<std::int64_t>(state) >> (i % 23);
+        const unsigned int shift = static_cast<unsigned int>(i % 64);
+        EXPECT_EQ(static_cast<std::int64_t>((static_cast<__int128>(a) * b) >> shift), fpm::detail::mul_q(a, b, shift));
+    }
+#endif
+}
+
+TEST(detail, mul_shift)
+{
+    // Values that don't fit in 32 bits are multiplied in two halves, also without a shift
+    EXPECT_EQ(std::int64_t{3} << 40, fpm::detail::mul_shift<false>(std::int64_t{1} << 40, 3, 0));
+    EXPECT_EQ(-(std::int64_t{3} << 40), fpm::detail::mul_shift<true>(-(std::int64_t{1} << 40), 3, 0));
+    EXPECT_EQ(std::int64_t{3} << 39, fpm::detail::mul_shift<false>(std::int64_t{1} << 40, 3, 1));
+}
+
+TEST(detail, pow_fixed)
+{
+    // Without fraction bits, the logarithm of large bases doesn't fit in 32 bits
+    EXPECT_EQ(std::uint64_t{1} << 40, fpm::detail::pow_fixed<true>(std::uint64_t{1} << 20, fpm::detail::pow_exponent(2), 0));
+    EXPECT_EQ(std::uint64_t{1} << 60, fpm::detail::pow_fixed<true>(std::uint64_t{1} << 30, fpm::detail::pow_exponent(2), 0));
+    EXPECT_EQ(0u, fpm::detail::pow_fixed<true>(std::uint64_t{1} << 20, fpm::detail::pow_exponent(-1), 0));
+
+    // The magnitude of the most negative exponent doesn't overflow
+    const fpm::detail::pow_exponent lowest(INT32_MIN);
+    EXPECT_EQ(std::uint32_t{1} << 31, lowest.magnitude);
+    EXPECT_TRUE(lowest.negative);
+    EXPECT_EQ(std::uint64_t{1} << 16, fpm::detail::pow_fixed<true>(std::uint64_t{1} << 16, lowest, 16));
+    EXPECT_EQ(0u, fpm::detail::pow_fixed<true>(std::uint64_t{2} << 16, lowest, 16));
+}
+
+TEST(detail, interpolation)
+{
+    // Without fraction bits, t is a whole number, and the scaled values don't fit in 32 bits
+    EXPECT_EQ(-(std::int64_t{3} << 40), fpm::detail::mul_fraction<false>(std::int64_t{1} << 40, -3, 0));
+    EXPECT_EQ(std::int64_t{5} << fpm::detail::INTERPOLATION_BITS, fpm::detail::bilinear_cell(1, 3, 5, 7).evaluate(0, 1, 0));
+    EXPECT_EQ(std::int64_t{7} << fpm::detail::INTERPOLATION_BITS, fpm::detail::bilinear_cell(1, 3, 5, 7).evaluate(1, 1, 0));
+    EXPECT_EQ(std::int64_t{2 * 2000} << fpm::detail::INTERPOLATION_BITS, fpm::detail::catmull_rom_segment(0, 1000, 2000, 3000).evaluate(1, 0));
+    EXPECT_EQ(std::int64_t{2 * 3000} << fpm::detail::INTERPOLATION_BITS, fpm::detail::catmull_rom_segment(0, 1000, 2000, 3000).evaluate(2, 0));
+}
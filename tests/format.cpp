@@ -0,0 +1,122 @@
+#include "common.hpp"
+#include <fpm/format.hpp>
+#include <iterator>
+#include <locale>
+#include <string>
+
+namespace
+{
+    // Formats a value with the format specification after the colon in a replacement field
+    template <typename CharT, typename T>
+    std::basic_string<CharT> format_value(const std::basic_string<CharT>& spec, T value, const std::locale& locale = std::locale::classic())
+    {
+        fpm::detail::format_spec<CharT> format_spec;
+        auto it = spec.begin();
+        EXPECT_EQ(nullptr, format_spec.parse(it, spec.end()));
+        EXPECT_TRUE(it == spec.end() || *it == '}');
+
+        std::basic_string<CharT> result;
+        format_spec.format(std::back_inserter(result), value, [&locale] { return locale; });
+        return result;
+    }
+
+    template <typename T>
+    std::string format_value(const char* spec, T value, const std::locale& locale = std::locale::classic())
+    {
+        return format_value(std::string(spec), value, locale);
+    }
+
+    const char* parse_error(const std::string& spec)
+    {
+        fpm::detail::format_spec<char> format_spec;
+        auto it = spec.begin();
+        return format_spec.parse(it, spec.end());
+    }
+
+    class grouping : public std::numpunct<char>
+    {
+    protected:
+        char do_decimal_point() const override { return ','; }
+        char do_thousands_sep() const override { return '.'; }
+        std::string do_grouping() const override { return "\3\2"; }
+    };
+}
+
+TEST(format, types)
+{
+    using P = fpm::fixed_16_16;
+
+    EXPECT_EQ("1234.5625", format_value("", P(1234.5625)));
+    EXPECT_EQ("-0.1", format_value("}", P(-0.1)));
+    EXPECT_EQ("1.23e+03", format_value(".3", P(1234.5625)));
+    EXPECT_EQ("1234.562", format_value(".3f", P(1234.5625)));
+    EXPECT_EQ("1234.562500", format_value("f", P(1234.5625)));
+    EXPECT_EQ("1.234562e+03", format_value("e", P(1234.5625)));
+    EXPECT_EQ("1.234562E+03", format_value("E", P(1234.5625)));
+    EXPECT_EQ("-0.100006", format_value("g", P(-0.1)));
+    EXPECT_EQ("1.34a4p+10", format_value("a", P(1234.5625)));
+    EXPECT_EQ("1.34A4P+10", format_value("A", P(1234.5625)));
+    EXPECT_EQ("12", format_value(".0f", P(12.5)));
+}
+
+TEST(format, padding)
+{
+    using P = fpm::fixed_16_16;
+
+    EXPECT_EQ("     1234.56", format_value("12.2f", P(1234.5625)));
+    EXPECT_EQ("1234.5625   ", format_value("<12", P(1234.5625)));
+    EXPECT_EQ(" 1234.5625  ", format_value("^12", P(1234.5625)));
+    EXPECT_EQ("****-0.1*****", format_value("*^13.1f", P(-0.1)));
+    EXPECT_EQ("\xE2\x82\xAC\xE2\x82\xAC" "1.5", format_value("\xE2\x82\xAC>5", P(1.5)));
+    EXPECT_EQ("+1.5", format_value("+", P(1.5)));
+    EXPECT_EQ(" 1.5", format_value(" ", P(1.5)));
+    EXPECT_EQ("-1.5", format_value(" ", P(-1.5)));
+    EXPECT_EQ("-0000000.100", format_value("012.3f", P(-0.1)));
+    EXPECT_EQ("+0001234.562", format_value("+012.3f", P(1234.5625)));
+    EXPECT_EQ("1.5         ", format_value("<012", P(1.5)));
+    EXPECT_EQ("1.5", format_value("2", P(1.5)));
+}
+
+TEST(format, locale)
+{
+    using P = fpm::fixed_24_8;
+
+    const std::locale locale(std::locale::classic(), new grouping);
+    EXPECT_EQ("1234.5", format_value("", P(1234.5), locale));
+    EXPECT_EQ("1.234,5", format_value("L", P(1234.5), locale));
+    EXPECT_EQ("-83.88.607,00", format_value(".2Lf", P(-8388607), locale));
+    EXPECT_EQ("  -1,2e+03", format_value("10.1Le", P(-1234.5), locale));
+    EXPECT_EQ("-001.234,5", format_value("010L", P(-1234.5), locale));
+}
+
+TEST(format, wide)
+{
+    using P = fpm::fixed_16_16;
+
+    EXPECT_EQ(L"**1.50", format_value(std::wstring(L"*>6.2f"), P(1.5)));
+}
+
+TEST(format, errors)
+{
+    EXPECT_NE(nullptr, parse_error("#"));
+    EXPECT_NE(nullptr, parse_error("{}"));
+    EXPECT_NE(nullptr, parse_error(".{}"));
+    EXPECT_NE(nullptr, parse_error("."));
+    EXPECT_NE(nullptr, parse_error("d"));
+    EXPECT_NE(nullptr, parse_error("ff"));
+    EXPECT_NE(nullptr, parse_error("99999999999"));
+    EXPECT_NE(nullptr, parse_error("{<5"));
+}
+
+#if defined(__cpp_lib_format)
+TEST(format, std_format)
+{
+    using P = fpm::fixed_16_16;
+
+    EXPECT_EQ("1234.5625 -0.1", std::format("{} {}", P(1234.5625), P(-0.1)));
+    EXPECT_EQ("[  1234.56]", std::format("[{:>9.2f}]", P(1234.5625)));
+    EXPECT_EQ(L"1.5e+00", std::format(L"{:.1e}", P(1.5)));
+    const P one(1);
+    EXPECT_THROW((void)std::vformat("{:d}", std::make_format_args(one)), std::format_error);
+}
+#endif
@@ -0,0 +1,125 @@
+#include "common.hpp"
+#include <fpm/math.hpp>
+#include <vector>
+
+TEST(hyperbolic, sinh)
+{
+    // For several values, verify that fpm::sinh is close to std::sinh.
+    using P = fpm::fixed_16_16;
+
+    // Maximum error we allow: one unit in the last place, plus a relative error for large results
+    const auto ULP = static_cast<double>(std::numeric_limits<P>::epsilon());
+    const auto MAX_REL_ERROR = std::ldexp(1.0, -27);
+
+    // Step by PI/100 to get an irregular pattern
+    for (double value = -11; value <= 11; value += 0.03141593)
+    {
+        const auto x = P(value);
+        const auto sinh_real = std::sinh(static_cast<double>(x));
+        EXPECT_NEAR(sinh_real, static_cast<double>(sinh(x)), ULP + std::abs(sinh_real) * MAX_REL_ERROR);
+    }
+
+    EXPECT_EQ(P(0), sinh(P(0)));
+    EXPECT_EQ(-sinh(P(2.5)), sinh(P(-2.5)));
+}
+
+TEST(hyperbolic, cosh)
+{
+    // For several values, verify that fpm::cosh is close to std::cosh.
+    using P = fpm::fixed_16_16;
+
+    // Maximum error we allow: one unit in the last place, plus a relative error for large results
+    const auto ULP = static_cast<double>(std::numeric_limits<P>::epsilon());
+    const auto MAX_REL_ERROR = std::ldexp(1.0, -27);
+
+    // Step by PI/100 to get an irregular pattern
+    for (double value = -11; value <= 11; value += 0.03141593)
+    {
+        const auto x = P(value);
+        const auto cosh_real = std::cosh(static_cast<double>(x));
+        EXPECT_NEAR(cosh_real, static_cast<double>(cosh(x)), ULP + cosh_real * MAX_REL_ERROR);
+    }
+
+    EXPECT_EQ(P(1), cosh(P(0)));
+    EXPECT_EQ(cosh(P(2.5)), cosh(P(-2.5)));
+}
+
+TEST(hyperbolic, tanh)
+{
+    // For several values and formats, verify that fpm::tanh is close to std::tanh.
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    // Step by PI/1000 to get an irregular pattern
+    for (double value = -10; value <= 10; value += 0.003141593)
+    {
+        const auto x16 = P16(value);
+        EXPECT_NEAR(std::tanh(static_cast<double>(x16)), static_cast<double>(tanh(x16)), ULP16);
+
+        const auto x24 = P24(value);
+        EXPECT_NEAR(std::tanh(static_cast<double>(x24)), static_cast<double>(tanh(x24)), ULP24);
+    }
+
+    EXPECT_EQ(P16(0), tanh(P16(0)));
+    EXPECT_EQ(-tanh(P16(0.75)), tanh(P16(-0.75)));
+    EXPECT_EQ(P16(1), tanh(std::numeric_limits<P16>::max()));
+    EXPECT_EQ(P16(-1), tanh(std::numeric_limits<P16>::min()));
+}
+
+TEST(hyperbolic, saturation)
+{
+    // Results that cannot be represented saturate instead of overflowing
+    using P = fpm::fixed_16_16;
+    constexpr auto max = std::numeric_limits<P>::max();
+    constexpr auto min = std::numeric_limits<P>::min();
+
+    EXPECT_EQ(max, sinh(P(11.1)));
+    EXPECT_EQ(min, sinh(P(-11.1)));
+    EXPECT_EQ(max, sinh(max));
+    EXPECT_EQ(min, sinh(min));
+    EXPECT_EQ(max, cosh(P(11.1)));
+    EXPECT_EQ(max, cosh(P(-11.1)));
+    EXPECT_EQ(max, cosh(min));
+
+    // Just below the saturation limit, the result is still accurate
+    const auto x = P(11.08);
+    EXPECT_NEAR(std::sinh(static_cast<double>(x)), static_cast<double>(sinh(x)), 0.001);
+    EXPECT_NEAR(std::cosh(static_cast<double>(-x)), static_cast<double>(cosh(-x)), 0.001);
+}
+
+TEST(hyperbolic, batch)
+{
+    // The batch functions give the same results as the scalar functions
+    using P = fpm::fixed_16_16;
+
+    std::vector<P> values;
+    for (double value = -12; value <= 12; value += 0.1)
+    {
+        values.push_back(P(value));
+    }
+
+    std::vector<P> results(values.size());
+    sinh(values.data(), values.data() + values.size(), results.data());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(sinh(values[i]), results[i]);
+    }
+
+    cosh(values.data(), values.data() + values.size(), results.data());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(cosh(values[i]), results[i]);
+    }
+
+    tanh(values.data(), values.data() + values.size(), results.data());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(tanh(values[i]), results[i]);
+    }
+
+    // In-place
+    tanh(values.data(), values.data() + values.size(), values.data());
+    EXPECT_EQ(results, values);
+}
@@ -55,6 +55,15 @@ namespace
             EXPECT_TRUE(ss);
 
             EXPECT_EQ(get_remainder(ss), expected_remaining) << "for text: \"" << text << "\"";
+
+            // More input after the text shouldn't matter
+            std::istringstream ss_more(text + "\n1");
+            ss_more.imbue(m_locale);
+
+            fpm::fixed<B, I, F> value_more;
+            ss_more >> value_more;
+            EXPECT_EQ(value_more, expected) << "for text: \"" << text << "\"";
+            EXPECT_TRUE(ss_more);
         }
 
         void test_invalid_conversion(const std::string& text, const std::string& expected_remaining = "")
@@ -71,6 +80,15 @@ namespace
             EXPECT_FALSE(ss.good()) << "for text: \"" << text << "\"";;
 
             EXPECT_EQ(get_remainder(ss), expected_remaining) << "for text: \"" << text << "\"";
+
+            // More input after the text shouldn't matter, unless there's no text at all
+            if (!text.empty())
+            {
+                std::istringstream ss_more(text + "\n1");
+                ss_more.imbue(m_locale);
+                ss_more >> value;
+                EXPECT_TRUE(ss_more.fail()) << "for text: \"" << text << "\"";
+            }
         }
 
     private:
@@ -309,4 +327,21 @@ TEST_F(input, infinity)
     test_invalid_conversion("infinix", "x");
     test_invalid_conversion("ib", "b");
     test_invalid_conversion("-ic", "c");
-}
\ No newline at end of file
+}
+
+TEST_F(input, many_values)
+{
+    using P = fpm::fixed_16_16;
+
+    // Values that end within the stream's buffer, mixed with ones that need the general path
+    std::istringstream ss("1.5 -2.25e1\n0x1.8p1\t+1234.5678 infinity 0.000000000001 12345678.9\n1e-2");
+    std::vector<P> values;
+    for (P value; ss >> value; ) {
+        values.push_back(value);
+    }
+    EXPECT_TRUE(ss.eof());
+
+    const std::vector<P> expected { P(1.5), P(-22.5), P(3), P(1234.5678), std::numeric_limits<P>::max(), P(0),
+                                    std::numeric_limits<P>::max(), P(0.01) };
+    EXPECT_EQ(expected, values);
+}
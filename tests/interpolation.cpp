@@ -0,0 +1,192 @@
+#include "common.hpp"
+#include <fpm/math.hpp>
+
+namespace
+{
+    double smoothstep_real(double edge0, double edge1, double x)
+    {
+        const double t = std::min(std::max((x - edge0) / (edge1 - edge0), 0.0), 1.0);
+        return t * t * (3 - 2 * t);
+    }
+
+    double catmull_rom_real(double p0, double p1, double p2, double p3, double t)
+    {
+        return (2 * p1 + (p2 - p0) * t + (2 * p0 - 5 * p1 + 4 * p2 - p3) * t * t + (3 * (p1 - p2) + p3 - p0) * t * t * t) / 2;
+    }
+}
+
+TEST(interpolation, lerp)
+{
+    using P = fpm::fixed_16_16;
+    const auto ULP = static_cast<double>(std::numeric_limits<P>::epsilon());
+
+    // The result is rounded once, so it is within half an ULP
+    for (double t = -1; t <= 2; t += 0.0031415)
+    {
+        const P a(-1234.5678), b(321.123), pt(t);
+        const double expected = static_cast<double>(a) + (static_cast<double>(b) - static_cast<double>(a)) * static_cast<double>(pt);
+        EXPECT_NEAR(expected, static_cast<double>(lerp(a, b, pt)), ULP / 2);
+    }
+
+    // The end points are exact, and the difference of the end points can't overflow
+    const auto min = std::numeric_limits<P>::lowest(), max = std::numeric_limits<P>::max();
+    EXPECT_EQ(min, lerp(min, max, P(0)));
+    EXPECT_EQ(max, lerp(min, max, P(1)));
+    EXPECT_EQ(P::from_raw_value(0), lerp(min, max, P(0.5)));
+    EXPECT_EQ(P(2), lerp(P(1), P(3), P(0.5)));
+    EXPECT_EQ(P(-1), lerp(P(1), P(3), P(-1)));
+
+    // The batch version matches the scalar version
+    const P as[] = { P(0), P(1.5), P(-7.25), min };
+    const P bs[] = { P(1), P(-2), P(100), max };
+    P results[4];
+    lerp(std::begin(as), std::end(as), std::begin(bs), P(0.3), results);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(lerp(as[i], bs[i], P(0.3)), results[i]);
+    }
+}
+
+TEST(interpolation, inverse_lerp)
+{
+    using P = fpm::fixed_16_16;
+    const auto ULP = static_cast<double>(std::numeric_limits<P>::epsilon());
+
+    for (double x = -100; x <= 100; x += 0.31415)
+    {
+        const P a(-12.5), b(37.75), px(x);
+        const double expected = (static_cast<double>(px) - static_cast<double>(a)) / (static_cast<double>(b) - static_cast<double>(a));
+        EXPECT_NEAR(expected, static_cast<double>(inverse_lerp(a, b, px)), ULP / 2);
+        EXPECT_NEAR(1 - expected, static_cast<double>(inverse_lerp(b, a, px)), ULP / 2);
+    }
+
+    EXPECT_EQ(P(0), inverse_lerp(P(2), P(6), P(2)));
+    EXPECT_EQ(P(1), inverse_lerp(P(2), P(6), P(6)));
+    EXPECT_EQ(P(0.25), inverse_lerp(P(2), P(6), P(3)));
+
+    const P xs[] = { P(2), P(3), P(10) };
+    P results[3];
+    inverse_lerp(P(2), P(6), std::begin(xs), std::end(xs), results);
+    EXPECT_EQ(P(0), results[0]);
+    EXPECT_EQ(P(0.25), results[1]);
+    EXPECT_EQ(P(2), results[2]);
+
+    // With 31 fraction bits, the differences of end points at opposite ends of the range take 32 bits
+    using Q = fpm::fixed<std::int32_t, std::int64_t, 31>;
+    const auto QULP = static_cast<double>(std::numeric_limits<Q>::epsilon());
+    const auto qmin = std::numeric_limits<Q>::lowest(), qmax = std::numeric_limits<Q>::max();
+    for (double x = -0.99; x < 0.99; x += 0.0123)
+    {
+        const Q qx(x);
+        EXPECT_NEAR((static_cast<double>(qx) + 1) / (static_cast<double>(qmax) + 1), static_cast<double>(inverse_lerp(qmin, qmax, qx)), QULP / 2);
+        EXPECT_NEAR((static_cast<double>(qmax) - static_cast<double>(qx)) / (static_cast<double>(qmax) + 1), static_cast<double>(inverse_lerp(qmax, qmin, qx)), QULP / 2);
+    }
+    EXPECT_EQ(Q(0), inverse_lerp(qmin, qmax, qmin));
+    EXPECT_EQ(Q(0.5), inverse_lerp(qmin, Q(0), Q(-0.5)));
+    EXPECT_EQ(Q(-0.25), inverse_lerp(Q(0.5), Q(-0.5), Q(0.75)));
+
+#ifndef NDEBUG
+    EXPECT_DEATH(inverse_lerp(P(1), P(1), P(0)), "");
+#endif
+}
+
+TEST(interpolation, smoothstep)
+{
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    for (double x = -2; x <= 4; x += 0.0031415)
+    {
+        const P16 x16(x);
+        EXPECT_NEAR(smoothstep_real(-0.5, 2.5, static_cast<double>(x16)), static_cast<double>(smoothstep(P16(-0.5), P16(2.5), x16)), ULP16);
+        EXPECT_NEAR(smoothstep_real(2.5, -0.5, static_cast<double>(x16)), static_cast<double>(smoothstep(P16(2.5), P16(-0.5), x16)), ULP16);
+
+        const P24 x24(x);
+        EXPECT_NEAR(smoothstep_real(-0.5, 2.5, static_cast<double>(x24)), static_cast<double>(smoothstep(P24(-0.5), P24(2.5), x24)), ULP24);
+    }
+
+    EXPECT_EQ(P16(0), smoothstep(P16(1), P16(2), P16(-100)));
+    EXPECT_EQ(P16(0.5), smoothstep(P16(1), P16(2), P16(1.5)));
+    EXPECT_EQ(P16(1), smoothstep(P16(1), P16(2), P16(100)));
+
+    const P16 xs[] = { P16(0), P16(1.5), P16(3) };
+    P16 results[3];
+    smoothstep(P16(1), P16(2), std::begin(xs), std::end(xs), results);
+    EXPECT_EQ(P16(0), results[0]);
+    EXPECT_EQ(P16(0.5), results[1]);
+    EXPECT_EQ(P16(1), results[2]);
+}
+
+TEST(interpolation, bilinear)
+{
+    using P = fpm::fixed_16_16;
+    const auto ULP = static_cast<double>(std::numeric_limits<P>::epsilon());
+
+    const P v00(10.5), v10(-20.25), v01(300.125), v11(7);
+    for (double tx = 0; tx <= 1; tx += 0.031415)
+    {
+        for (double ty = 0; ty <= 1; ty += 0.031415)
+        {
+            const P ptx(tx), pty(ty);
+            const double dx = static_cast<double>(ptx), dy = static_cast<double>(pty);
+            const double r0 = static_cast<double>(v00) + (static_cast<double>(v10) - static_cast<double>(v00)) * dx;
+            const double r1 = static_cast<double>(v01) + (static_cast<double>(v11) - static_cast<double>(v01)) * dx;
+            EXPECT_NEAR(r0 + (r1 - r0) * dy, static_cast<double>(bilinear(v00, v10, v01, v11, ptx, pty)), ULP / 2 + 1e-9);
+        }
+    }
+
+    EXPECT_EQ(v00, bilinear(v00, v10, v01, v11, P(0), P(0)));
+    EXPECT_EQ(v10, bilinear(v00, v10, v01, v11, P(1), P(0)));
+    EXPECT_EQ(v01, bilinear(v00, v10, v01, v11, P(0), P(1)));
+    EXPECT_EQ(v11, bilinear(v00, v10, v01, v11, P(1), P(1)));
+
+    // The extremes of the type don't overflow
+    const auto min = std::numeric_limits<P>::lowest(), max = std::numeric_limits<P>::max();
+    EXPECT_EQ(max, bilinear(min, max, min, max, P(1), P(0.5)));
+    EXPECT_EQ(min, bilinear(min, max, max, min, P(1), P(1)));
+
+    // The batch version matches the scalar version
+    const P txs[] = { P(0), P(0.25), P(1), P(-0.5), P(0.7) };
+    const P tys[] = { P(0), P(0.75), P(1), P(2), P(0.3) };
+    P results[5];
+    bilinear(v00, v10, v01, v11, std::begin(txs), std::end(txs), std::begin(tys), results);
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(bilinear(v00, v10, v01, v11, txs[i], tys[i]), results[i]);
+    }
+}
+
+TEST(interpolation, catmull_rom)
+{
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    for (double t = 0; t <= 1; t += 0.0031415)
+    {
+        const P16 a(-3.5), b(10.25), c(2), d(-100), t16(t);
+        EXPECT_NEAR(catmull_rom_real(-3.5, 10.25, 2, -100, static_cast<double>(t16)), static_cast<double>(catmull_rom(a, b, c, d, t16)), ULP16 / 2 + 1e-9);
+
+        const P24 e(0.5), f(-0.25), g(1.75), h(0.125), t24(t);
+        EXPECT_NEAR(catmull_rom_real(0.5, -0.25, 1.75, 0.125, static_cast<double>(t24)), static_cast<double>(catmull_rom(e, f, g, h, t24)), ULP24 / 2 + 1e-9);
+    }
+
+    // The spline passes through the middle points, and reproduces straight lines
+    EXPECT_EQ(P16(10.25), catmull_rom(P16(-3.5), P16(10.25), P16(2), P16(-100), P16(0)));
+    EXPECT_EQ(P16(2), catmull_rom(P16(-3.5), P16(10.25), P16(2), P16(-100), P16(1)));
+    EXPECT_EQ(P16(1.75), catmull_rom(P16(0), P16(1), P16(2), P16(3), P16(0.75)));
+
+    // The batch version matches the scalar version, also in-place
+    P16 ts[] = { P16(0), P16(0.1), P16(0.5), P16(0.9), P16(1) };
+    P16 results[5];
+    catmull_rom(P16(-3.5), P16(10.25), P16(2), P16(-100), std::begin(ts), std::end(ts), results);
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(catmull_rom(P16(-3.5), P16(10.25), P16(2), P16(-100), ts[i]), results[i]);
+    }
+    catmull_rom(P16(-3.5), P16(10.25), P16(2), P16(-100), std::begin(ts), std::end(ts), ts);
+    EXPECT_TRUE(std::equal(std::begin(ts), std::end(ts), std::begin(results)));
+}
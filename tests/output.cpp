@@ -94,6 +94,12 @@ protected:
         // Stream contents should match
         EXPECT_EQ(ss_float.str(), ss_fixed.str()) << "for value: " << value;
 
+        // A formatter with the same properties should write the same
+        const fpm::formatter formatter(create_stream());
+        char buffer[4096];
+        const auto size = formatter.format(buffer, sizeof(buffer), P(value));
+        EXPECT_EQ(ss_fixed.str(), std::string(buffer, size)) << "for value: " << value;
+
         // Stream properties should match afterwards
         EXPECT_EQ(ss_float.flags(), ss_fixed.flags());
         EXPECT_EQ(ss_float.precision(), ss_fixed.precision());
@@ -269,6 +275,11 @@ TEST_F(output_rounding, tie_rounding)
     test(0.5, 0);
     test(-0.5, 0);
 
+    // The last integral digit decides
+    test(12.5, 0);
+    test(-21.5, 0);
+    test(1234.5, 0);
+
     test(0.5, 1);
     test(-0.5, 1);
 
@@ -333,3 +344,33 @@ TEST_F(output_specific, type_limit)
     test("7.938", F4::from_raw_value(127), 3, std::ios::fixed);
     test("7.938e+00", F4::from_raw_value(127), 3, std::ios::scientific);
 }
+
+TEST(output_formatter, formatter)
+{
+    using P = fpm::fixed_16_16;
+
+    // The default options are those of a new stream
+    const fpm::formatter defaults;
+    char buffer[32];
+    EXPECT_EQ(std::string("-1.125"), std::string(buffer, defaults.format(buffer, sizeof(buffer), P(-1.125))));
+
+    // The width applies to every number, unlike with a stream
+    std::stringstream ss;
+    const fpm::formatter formatter(std::ios::fixed | std::ios::left, 2, 8);
+    formatter.format(*ss.rdbuf(), P(1.5));
+    formatter.format(*ss.rdbuf(), P(-20.25));
+    EXPECT_EQ("1.50    -20.25  ", ss.str());
+
+    // The output is truncated to the buffer, but the entire length is returned
+    std::fill_n(buffer, sizeof(buffer), 'x');
+    EXPECT_EQ(8u, formatter.format(buffer, 3, P(1.5)));
+    EXPECT_EQ("1.5xx", std::string(buffer, 5));
+    EXPECT_EQ(8u, formatter.format(nullptr, 0, P(1.5)));
+
+    // Wide characters
+    std::wstringstream wss;
+    wss.setf(std::ios::scientific);
+    const fpm::wformatter wformatter(wss);
+    wchar_t wbuffer[32];
+    EXPECT_EQ(std::wstring(L"1.250000e+02"), std::wstring(wbuffer, wformatter.format(wbuffer, 32, P(125))));
+}
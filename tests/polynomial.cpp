@@ -0,0 +1,70 @@
+#include "common.hpp"
+#include <fpm/math.hpp>
+
+namespace
+{
+    // Evaluates the polynomial with the coefficients as Q.30
+    double poly_real(std::initializer_list<std::int64_t> coeffs, double x)
+    {
+        double result = 0, power = 1;
+        for (auto c : coeffs)
+        {
+            result += c / 1073741824.0 * power;
+            power *= x;
+        }
+        return result;
+    }
+}
+
+TEST(polynomial, horner_estrin)
+{
+    // For several values and formats, verify that both schemes are within 1 ULP of the exact polynomial.
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    // 1 - x/2 + x^2/4 - x^3/8
+    using Cubic16 = fpm::poly<P16, 30, 1073741824, -536870912, 268435456, -134217728>;
+    using Cubic24 = fpm::poly<P24, 30, 1073741824, -536870912, 268435456, -134217728>;
+    static_assert(Cubic16::degree == 3, "degree must be 3");
+
+    // The Taylor series of e^x up to degree 7
+    using Exp16 = fpm::poly<P16, 30, 1073741824, 1073741824, 536870912, 178956971, 44739243, 8947849, 1491308, 213044>;
+    using Exp24 = fpm::poly<P24, 30, 1073741824, 1073741824, 536870912, 178956971, 44739243, 8947849, 1491308, 213044>;
+
+    // Step by PI/1000 to get an irregular pattern
+    for (double value = -4; value <= 4; value += 0.003141593)
+    {
+        const auto x16 = P16(value);
+        const auto d16 = static_cast<double>(x16);
+        EXPECT_NEAR(poly_real({ 1073741824, -536870912, 268435456, -134217728 }, d16), static_cast<double>(Cubic16::horner(x16)), ULP16);
+        EXPECT_NEAR(poly_real({ 1073741824, -536870912, 268435456, -134217728 }, d16), static_cast<double>(Cubic16::estrin(x16)), ULP16);
+        EXPECT_NEAR(poly_real({ 1073741824, 1073741824, 536870912, 178956971, 44739243, 8947849, 1491308, 213044 }, d16), static_cast<double>(Exp16::horner(x16)), ULP16);
+        EXPECT_NEAR(poly_real({ 1073741824, 1073741824, 536870912, 178956971, 44739243, 8947849, 1491308, 213044 }, d16), static_cast<double>(Exp16::estrin(x16)), ULP16);
+        EXPECT_EQ(Exp16::estrin(x16), Exp16()(x16));
+
+        const auto x24 = P24(value / 4);
+        const auto d24 = static_cast<double>(x24);
+        EXPECT_NEAR(poly_real({ 1073741824, -536870912, 268435456, -134217728 }, d24), static_cast<double>(Cubic24::evaluate(x24)), ULP24);
+        EXPECT_NEAR(poly_real({ 1073741824, 1073741824, 536870912, 178956971, 44739243, 8947849, 1491308, 213044 }, d24), static_cast<double>(Exp24::horner(x24)), ULP24);
+        EXPECT_NEAR(poly_real({ 1073741824, 1073741824, 536870912, 178956971, 44739243, 8947849, 1491308, 213044 }, d24), static_cast<double>(Exp24::estrin(x24)), ULP24);
+    }
+}
+
+TEST(polynomial, range)
+{
+    using P = fpm::fixed_16_16;
+
+    // A constant polynomial
+    EXPECT_EQ(P(2.5), (fpm::poly<P, 30, 2684354560>::evaluate(P(1000))));
+
+    // The intermediate products of x^2 / 1024 exceed 64 bits for large x, but the result does not
+    using Square = fpm::poly<P, 30, 0, 0, 1048576>;
+    EXPECT_EQ(P(976.5625), Square::horner(P(1000)));
+    EXPECT_EQ(P(976.5625), Square::estrin(P(-1000)));
+
+    // The coefficients can have fewer fraction bits than the argument
+    using Line = fpm::poly<P, 4, 40, -24>;
+    EXPECT_EQ(P(2.5 - 1.5 * 3.25), Line::evaluate(P(3.25)));
+}
@@ -1,5 +1,7 @@
 #include "common.hpp"
 #include <fpm/math.hpp>
+#include <algorithm>
+#include <vector>
 
 TEST(power, exp)
 {
@@ -17,6 +19,38 @@ TEST(power, exp)
     }
 }
 
+TEST(power, exp_precision)
+{
+    // Verify that fpm::exp and fpm::exp2 have a small relative error, for negative arguments as well
+    using P = fpm::fixed_16_16;
+
+    // Maximum error we allow: one unit in the last place, plus the kernel's relative error
+    const auto ULP = static_cast<double>(std::numeric_limits<P>::epsilon());
+    const auto MAX_REL_ERROR = std::ldexp(1.0, -28);
+
+    // Step by PI/100 to get an irregular pattern
+    for (double value = -12; value <= 10; value += 0.03141593)
+    {
+        const auto x = P(value);
+        const auto exp_real = std::exp(static_cast<double>(x));
+        EXPECT_NEAR(static_cast<double>(exp(x)), exp_real, ULP + exp_real * MAX_REL_ERROR);
+
+        const auto exp2_real = std::exp2(static_cast<double>(x));
+        EXPECT_NEAR(static_cast<double>(exp2(x)), exp2_real, ULP + exp2_real * MAX_REL_ERROR);
+    }
+
+    // Integral powers of two are exact
+    EXPECT_EQ(P(1), exp(P(0)));
+    EXPECT_EQ(P(1), exp2(P(0)));
+    EXPECT_EQ(P(8), exp2(P(3)));
+    EXPECT_EQ(P(0.25), exp2(P(-2)));
+    EXPECT_EQ(P::from_raw_value(1), exp2(P(-16)));
+
+    // Results that are too small to represent are zero
+    EXPECT_EQ(P(0), exp(P(-20)));
+    EXPECT_EQ(P(0), exp2(P(-30)));
+}
+
 TEST(power, exp2)
 {
     // For several values, verify that fpm::exp2 is close to std::exp2.
@@ -33,6 +67,23 @@ TEST(power, exp2)
     }
 }
 
+#if defined(__SIZEOF_INT128__)
+TEST(power, exp_wide)
+{
+    // BaseTypes wider than 32 bits use generic calculations
+    using P = fpm::fixed<std::int64_t, __int128, 24>;
+
+    // Maximum relative error (percentage) we allow
+    constexpr auto MAX_ERROR_PERC = 0.00002;
+
+    for (double value = -5; value <= 25; value += 0.1)
+    {
+        EXPECT_TRUE(HasMaximumError(static_cast<double>(exp(P(value))), std::exp(value), MAX_ERROR_PERC));
+        EXPECT_TRUE(HasMaximumError(static_cast<double>(exp2(P(value))), std::exp2(value), MAX_ERROR_PERC));
+    }
+}
+#endif
+
 TEST(power, expm1)
 {
     // For several values, verify that fpm::expm1 is close to std::expm1.
@@ -109,6 +160,64 @@ TEST(power, log2)
 #endif
 }
 
+TEST(power, log_precision)
+{
+    // Verify that the logarithms are within one unit in the last place, for several formats
+    const auto test = [](double value)
+    {
+        using P16 = fpm::fixed_16_16;
+        const auto ulp16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+        const auto x16 = P16(value);
+        EXPECT_NEAR(std::log2(static_cast<double>(x16)), static_cast<double>(log2(x16)), ulp16);
+        EXPECT_NEAR(std::log(static_cast<double>(x16)), static_cast<double>(log(x16)), ulp16);
+        EXPECT_NEAR(std::log10(static_cast<double>(x16)), static_cast<double>(log10(x16)), ulp16);
+
+        using P24 = fpm::fixed_8_24;
+        const auto ulp24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+        const auto x24 = P24(value / 256);
+        EXPECT_NEAR(std::log2(static_cast<double>(x24)), static_cast<double>(log2(x24)), ulp24);
+        EXPECT_NEAR(std::log(static_cast<double>(x24)), static_cast<double>(log(x24)), ulp24);
+        EXPECT_NEAR(std::log10(static_cast<double>(x24)), static_cast<double>(log10(x24)), ulp24);
+    };
+
+    // Step by PI/10 to get an irregular pattern
+    for (double value = 0.001; value <= 30000; value += 0.3141593)
+    {
+        test(value);
+    }
+
+    // Powers of two are exact, down to the smallest representable value
+    for (int shift = 0; shift < 31; ++shift)
+    {
+        const auto x = fpm::fixed_16_16::from_raw_value(std::int32_t{1} << shift);
+        EXPECT_EQ(fpm::fixed_16_16(shift - 16), log2(x));
+        const auto y = fpm::fixed<std::int32_t, std::int64_t, 16, false>::from_raw_value(std::int32_t{1} << shift);
+        EXPECT_EQ(decltype(y)(shift - 16), log2(y));
+    }
+    EXPECT_EQ(fpm::fixed_16_16(0), log(fpm::fixed_16_16(1)));
+    EXPECT_EQ(fpm::fixed_16_16(0), log10(fpm::fixed_16_16(1)));
+}
+
+#if defined(__SIZEOF_INT128__)
+TEST(power, log_wide)
+{
+    // BaseTypes wider than 32 bits use generic calculations
+    using P = fpm::fixed<std::int64_t, __int128, 24>;
+
+    // Maximum absolute error we allow
+    constexpr auto MAX_ERROR = 0.00005;
+
+    // Grow geometrically, with an irregular offset, to cover the entire range
+    for (double value = 0.001; value <= 1e9; value = value * 1.5 + 0.3141593)
+    {
+        const auto x = static_cast<double>(P(value));
+        EXPECT_NEAR(std::log2(x), static_cast<double>(log2(P(value))), MAX_ERROR);
+        EXPECT_NEAR(std::log(x), static_cast<double>(log(P(value))), MAX_ERROR);
+        EXPECT_NEAR(std::log10(x), static_cast<double>(log10(P(value))), MAX_ERROR);
+    }
+}
+#endif
+
 TEST(power, log10)
 {
     // For several values, verify that fpm::log10 is close to std::log10exp.
@@ -221,6 +330,109 @@ TEST(power, pow)
 #endif
 }
 
+TEST(power, pow_precision)
+{
+    // Verify that the fused fpm::pow is within one unit in the last place of the result
+    using P = fpm::fixed_16_16;
+    const auto ULP = static_cast<double>(std::numeric_limits<P>::epsilon());
+
+    // Step irregularly through the bases and exponents
+    for (double base = 0.01; base <= 100; base += 0.3141593)
+    {
+        for (double exp = -3; exp <= 3; exp += 0.0271828)
+        {
+            const auto pow_real = std::pow(static_cast<double>(P(base)), static_cast<double>(P(exp)));
+            if (pow_real < 30000)
+            {
+                const auto pow_fixed = static_cast<double>(pow(P(base), P(exp)));
+                EXPECT_NEAR(pow_fixed, pow_real, ULP * std::max(1.0, pow_real));
+            }
+        }
+    }
+
+    // Negative whole exponents of positive bases don't accumulate division errors
+    EXPECT_NEAR(std::pow(static_cast<double>(P(0.15)), -3), static_cast<double>(pow(P(0.15), P(-3))), ULP * 300);
+    EXPECT_EQ(P(0.125), pow(P(2), P(-3)));
+    EXPECT_EQ(P(4), pow(P(16), P(0.5)));
+
+    // The most negative exponent
+    const P lowest = std::numeric_limits<P>::lowest();
+    EXPECT_EQ(P(1), pow(P(1), lowest));
+    EXPECT_EQ(P(0), pow(P(2), lowest));
+    EXPECT_EQ(P(1), pow(P(1), lowest + std::numeric_limits<P>::epsilon()));
+}
+
+#if defined(__SIZEOF_INT128__)
+TEST(power, pow_wide)
+{
+    // BaseTypes wider than 32 bits use generic calculations
+    using P = fpm::fixed<std::int64_t, __int128, 24>;
+
+    // Maximum relative error we allow, on top of one unit in the last place for small results
+    constexpr auto MAX_ERROR = 0.0002;
+    const auto ulp = static_cast<double>(std::numeric_limits<P>::epsilon());
+
+    for (double base = 0.25; base <= 1000; base *= 1.7)
+    {
+        for (double exp = -2.5; exp <= 2.5; exp += 0.3)
+        {
+            const auto expected = std::pow(static_cast<double>(P(base)), static_cast<double>(P(exp)));
+            EXPECT_NEAR(expected, static_cast<double>(pow(P(base), P(exp))), expected * MAX_ERROR + ulp);
+        }
+    }
+}
+#endif
+
+TEST(power, pow_batch)
+{
+    // The batched variant gives the same results as the scalar variant
+    using P = fpm::fixed_16_16;
+
+    std::vector<P> values;
+    for (double value = -2; value <= 100; value += 0.3141593)
+    {
+        values.push_back(P(value));
+    }
+    values.push_back(P(0));
+
+    for (double exp : { 1 / 2.2, 2.2, -0.75, 3.0 })
+    {
+        std::vector<P> bases;
+        for (auto value : values)
+        {
+            // Fractional exponents only apply to non-negative bases
+            if (value >= P(0) || P(exp) == floor(P(exp)))
+            {
+                bases.push_back(value);
+            }
+        }
+        if (exp < 0)
+        {
+            bases.pop_back();
+        }
+
+        std::vector<P> results(bases.size());
+        pow(bases.data(), bases.data() + bases.size(), P(exp), results.data());
+        for (std::size_t i = 0; i < bases.size(); ++i)
+        {
+            EXPECT_EQ(pow(bases[i], P(exp)), results[i]) << "base " << static_cast<double>(bases[i]) << ", exponent " << exp;
+        }
+
+        // In-place
+        pow(bases.data(), bases.data() + bases.size(), P(exp), bases.data());
+        EXPECT_EQ(results, bases);
+    }
+
+    // The most negative exponent
+    const P lowest = std::numeric_limits<P>::lowest();
+    const P bases[] = { P(1), P(2), P(1.5) + std::numeric_limits<P>::epsilon() };
+    P results[3];
+    pow(std::begin(bases), std::end(bases), lowest + std::numeric_limits<P>::epsilon(), results);
+    EXPECT_EQ(P(1), results[0]);
+    EXPECT_EQ(P(0), results[1]);
+    EXPECT_EQ(P(0), results[2]);
+}
+
 TEST(power, pow_int)
 {
     // For several combinations of x and y, verify that fpm::pow is close to std::pow.
@@ -311,6 +523,296 @@ TEST(power, sqrt_24)
 
 }
 
+namespace
+{
+// Reference square root: calculates the raw result bit by bit, rounded to nearest, from:
+// https://en.wikipedia.org/wiki/Methods_of_computing_square_roots#Binary_numeral_system_.28base_2.29
+template <typename B, typename I, unsigned int F, bool R>
+fpm::fixed<B, I, F, R> reference_sqrt(fpm::fixed<B, I, F, R> x)
+{
+    I num = I{x.raw_value()} << F;
+    I res = 0;
+    for (I bit = I{1} << (sizeof(I) * 8 - 2); bit != 0; bit >>= 2)
+    {
+        const I val = res + bit;
+        res >>= 1;
+        if (num >= val)
+        {
+            num -= val;
+            res += bit;
+        }
+    }
+    if (num > res)
+    {
+        res++;
+    }
+    return fpm::fixed<B, I, F, R>::from_raw_value(static_cast<B>(res));
+}
+
+template <typename P>
+void test_sqrt_exact()
+{
+    using B = decltype(P().raw_value());
+
+    // Every power of two, and its neighbours
+    for (int shift = 0; shift < std::numeric_limits<B>::digits; ++shift)
+    {
+        for (B offset = -1; offset <= 1; ++offset)
+        {
+            const auto x = P::from_raw_value((B{1} << shift) + offset);
+            EXPECT_EQ(reference_sqrt(x), sqrt(x)) << "raw value " << x.raw_value();
+        }
+    }
+
+    // An irregular sweep over the entire positive range, with the same number of steps for every BaseType
+    const B step = (B{104729} << (std::numeric_limits<B>::digits - 31)) | 1;
+    for (B raw = 0; raw >= 0 && raw < std::numeric_limits<B>::max() - step; raw += step)
+    {
+        const auto x = P::from_raw_value(raw);
+        EXPECT_EQ(reference_sqrt(x), sqrt(x)) << "raw value " << x.raw_value();
+    }
+
+    const auto max = std::numeric_limits<P>::max();
+    EXPECT_EQ(reference_sqrt(max), sqrt(max));
+}
+}
+
+TEST(power, sqrt_exact)
+{
+    // Verify that fpm::sqrt is correctly rounded for various formats
+    test_sqrt_exact<fpm::fixed_24_8>();
+    test_sqrt_exact<fpm::fixed<std::int32_t, std::int64_t, 15>>();
+    test_sqrt_exact<fpm::fixed_16_16>();
+    test_sqrt_exact<fpm::fixed_8_24>();
+    test_sqrt_exact<fpm::fixed<std::int32_t, std::int64_t, 30>>();
+#if defined(__SIZEOF_INT128__)
+    // BaseTypes wider than 32 bits
+    test_sqrt_exact<fpm::fixed<std::int64_t, __int128, 24>>();
+    test_sqrt_exact<fpm::fixed<std::int64_t, __int128, 32>>();
+    EXPECT_NEAR(std::sqrt(1e9), static_cast<double>(sqrt(fpm::fixed<std::int64_t, __int128, 24>(1e9))), 1e-7);
+#endif
+}
+
+TEST(power, hypot)
+{
+    using P = fpm::fixed_16_16;
+
+    // Maximum absolute error we allow: half a unit in the last place, since the result is rounded to nearest
+    const auto MAX_ERROR = static_cast<double>(std::numeric_limits<P>::epsilon()) / 2;
+
+    for (double x = -30000; x <= 30000; x += 1234.5678)
+    {
+        for (double y = -300; y <= 300; y += 3.141593)
+        {
+            const P fx{x / 100}, fy{y};
+            const auto hypot_real = std::hypot(static_cast<double>(fx), static_cast<double>(fy));
+            EXPECT_NEAR(hypot_real, static_cast<double>(hypot(fx, fy)), MAX_ERROR);
+            EXPECT_EQ(hypot(fx, fy), hypot(fy, -fx));
+        }
+    }
+
+    EXPECT_EQ(P(0), hypot(P(0), P(0)));
+    EXPECT_EQ(P(5), hypot(P(3), P(-4)));
+
+    // Squares beyond the fixed-point range don't overflow
+    EXPECT_EQ(P(25000), hypot(P(15000), P(20000)));
+    EXPECT_EQ(P(32767), hypot(P(32767), P(0)));
+
+    // Results beyond the range saturate
+    EXPECT_EQ(std::numeric_limits<P>::max(), hypot(P(30000), P(30000)));
+    EXPECT_EQ(std::numeric_limits<P>::max(), hypot(std::numeric_limits<P>::min(), std::numeric_limits<P>::min()));
+}
+
+#if defined(__SIZEOF_INT128__)
+TEST(power, hypot_wide)
+{
+    // Wider BaseTypes sum the squares in the fixed-point type
+    using P = fpm::fixed<std::int64_t, __int128, 24>;
+
+    for (double x = -3e4; x <= 3e4; x += 1234.5678)
+    {
+        for (double y = -300; y <= 300; y += 3.141593)
+        {
+            const P fx{x}, fy{y};
+            const auto hypot_real = std::hypot(static_cast<double>(fx), static_cast<double>(fy));
+            EXPECT_NEAR(hypot_real, static_cast<double>(hypot(fx, fy)), 1e-7 * hypot_real + 1e-7);
+        }
+    }
+    EXPECT_EQ(P(50000), hypot(P(30000), P(-40000)));
+}
+#endif
+
+TEST(power, fast_hypot)
+{
+    using P = fpm::fixed_16_16;
+
+    // The error bounds hold for the real-valued results, so allow one unit in the last place on top
+    const auto ULP = static_cast<double>(std::numeric_limits<P>::epsilon());
+
+    for (double x = -100; x <= 100; x += 3.141593)
+    {
+        for (double y = -100; y <= 100; y += 2.718282)
+        {
+            const P fx{x}, fy{y};
+            const auto hypot_real = std::hypot(static_cast<double>(fx), static_cast<double>(fy));
+
+            const auto amb = static_cast<double>(fpm::fast::hypot(fx, fy));
+            EXPECT_LE(amb, hypot_real * 1.0396 + ULP);
+            EXPECT_GE(amb, hypot_real * 0.9604 - ULP);
+
+            // The octagonal approximation never overestimates
+            const auto octagonal = static_cast<double>(fpm::fast::hypot_octagonal(fx, fy));
+            EXPECT_LE(octagonal, hypot_real);
+            EXPECT_GE(octagonal, hypot_real * 0.9238 - ULP);
+        }
+    }
+
+    // Both are exact on the axes, up to the approximation's scale
+    EXPECT_EQ(P(7), fpm::fast::hypot_octagonal(P(-7), P(0)));
+    EXPECT_NEAR(7 * 0.960433870, static_cast<double>(fpm::fast::hypot(P(0), P(-7))), ULP);
+
+    // Results beyond the range saturate
+    constexpr auto max = std::numeric_limits<P>::max();
+    constexpr auto min = std::numeric_limits<P>::min();
+    EXPECT_EQ(max, fpm::fast::hypot(min, min));
+    EXPECT_EQ(max, fpm::fast::hypot_octagonal(min, max));
+}
+
+TEST(power, rsqrt)
+{
+    // For several values, verify that fpm::rsqrt is close to 1/std::sqrt.
+    using P = fpm::fixed_16_16;
+
+    // Maximum absolute error we allow: one unit in the last place
+    const auto MAX_ERROR = static_cast<double>(std::numeric_limits<P>::epsilon());
+
+    // Small numbers
+    for (double value = 0.01; value <= 100; value += 0.01)
+    {
+        auto rsqrt_real = 1 / std::sqrt(static_cast<double>(P(value)));
+        auto rsqrt_fixed = static_cast<double>(rsqrt(P(value)));
+        EXPECT_NEAR(rsqrt_fixed, rsqrt_real, MAX_ERROR);
+    }
+
+    // Larger numbers, step by PI/10 to get an irregular pattern
+    for (double value = 1; value <= 10000; value += 0.3141593)
+    {
+        auto rsqrt_real = 1 / std::sqrt(static_cast<double>(P(value)));
+        auto rsqrt_fixed = static_cast<double>(rsqrt(P(value)));
+        EXPECT_NEAR(rsqrt_fixed, rsqrt_real, MAX_ERROR);
+    }
+
+    // Every power of two, down to the smallest representable value
+    for (int shift = 0; shift < 31; ++shift)
+    {
+        const auto value = P::from_raw_value(std::int32_t{1} << shift);
+        auto rsqrt_real = 1 / std::sqrt(static_cast<double>(value));
+        auto rsqrt_fixed = static_cast<double>(rsqrt(value));
+        EXPECT_NEAR(rsqrt_fixed, rsqrt_real, MAX_ERROR);
+    }
+
+    EXPECT_EQ(P(1), rsqrt(P(1)));
+    EXPECT_EQ(P(0.5), rsqrt(P(4)));
+    EXPECT_EQ(P(256), rsqrt(P::from_raw_value(1)));
+
+#ifndef NDEBUG
+    EXPECT_DEATH(rsqrt(P(0)), "");
+    EXPECT_DEATH(rsqrt(P(-1)), "");
+#endif
+}
+
+TEST(power, rsqrt_odd_fraction)
+{
+    // With an odd number of fraction bits, the result's power of two is not integral
+    using P = fpm::fixed<std::int32_t, std::int64_t, 15>;
+
+    // Maximum absolute error we allow: one unit in the last place
+    const auto MAX_ERROR = static_cast<double>(std::numeric_limits<P>::epsilon());
+
+    for (double value = 0.01; value <= 100; value += 0.01)
+    {
+        auto rsqrt_real = 1 / std::sqrt(static_cast<double>(P(value)));
+        auto rsqrt_fixed = static_cast<double>(rsqrt(P(value)));
+        EXPECT_NEAR(rsqrt_fixed, rsqrt_real, MAX_ERROR);
+    }
+}
+
+TEST(power, normalize2)
+{
+    using P = fpm::fixed_16_16;
+
+    // Maximum absolute error we allow: one unit in the last place
+    const auto MAX_ERROR = static_cast<double>(std::numeric_limits<P>::epsilon());
+
+    for (double x = -100; x <= 100; x += 3.141593)
+    {
+        for (double y = -100; y <= 100; y += 2.718282)
+        {
+            P fx{x}, fy{y};
+            const auto length = std::hypot(static_cast<double>(fx), static_cast<double>(fy));
+            const auto x_real = static_cast<double>(fx) / length;
+            const auto y_real = static_cast<double>(fy) / length;
+            normalize2(&fx, &fy);
+            EXPECT_NEAR(static_cast<double>(fx), x_real, MAX_ERROR);
+            EXPECT_NEAR(static_cast<double>(fy), y_real, MAX_ERROR);
+        }
+    }
+
+    // Axis-aligned vectors normalize exactly
+    P x{-25}, y{0};
+    normalize2(&x, &y);
+    EXPECT_EQ(P(-1), x);
+    EXPECT_EQ(P(0), y);
+
+    // Large vectors don't overflow
+    x = std::numeric_limits<P>::max();
+    y = std::numeric_limits<P>::min();
+    normalize2(&x, &y);
+    EXPECT_NEAR(static_cast<double>(x), std::sqrt(0.5), MAX_ERROR);
+    EXPECT_NEAR(static_cast<double>(y), -std::sqrt(0.5), MAX_ERROR);
+
+#ifndef NDEBUG
+    x = y = P(0);
+    EXPECT_DEATH(normalize2(&x, &y), "");
+#endif
+}
+
+TEST(power, normalize3)
+{
+    using P = fpm::fixed_16_16;
+
+    // Maximum absolute error we allow: one unit in the last place
+    const auto MAX_ERROR = static_cast<double>(std::numeric_limits<P>::epsilon());
+
+    for (double x = -100; x <= 100; x += 9.424778)
+    {
+        for (double y = -100; y <= 100; y += 8.154845)
+        {
+            for (double z = -100; z <= 100; z += 7.389056)
+            {
+                P fx{x}, fy{y}, fz{z};
+                const auto dx = static_cast<double>(fx), dy = static_cast<double>(fy), dz = static_cast<double>(fz);
+                const auto length = std::sqrt(dx * dx + dy * dy + dz * dz);
+                normalize3(&fx, &fy, &fz);
+                EXPECT_NEAR(static_cast<double>(fx), dx / length, MAX_ERROR);
+                EXPECT_NEAR(static_cast<double>(fy), dy / length, MAX_ERROR);
+                EXPECT_NEAR(static_cast<double>(fz), dz / length, MAX_ERROR);
+            }
+        }
+    }
+
+    P x{0}, y{0}, z{0.5};
+    normalize3(&x, &y, &z);
+    EXPECT_EQ(P(0), x);
+    EXPECT_EQ(P(0), y);
+    EXPECT_EQ(P(1), z);
+
+#ifndef NDEBUG
+    z = P(0);
+    EXPECT_DEATH(normalize3(&x, &y, &z), "");
+#endif
+}
+
 TEST(power, cbrt)
 {
     // For several values, verify that fpm::cbrt is close to std::cbrt.
@@ -353,3 +855,117 @@ TEST(power, cbrt_24)
         EXPECT_TRUE(HasMaximumError(cbrt_fixed, cbrt_real, MAX_ERROR_PERC));
     }
 }
+
+namespace
+{
+// Reference cube root: calculates the raw result digit by digit, rounded down.
+// Taken from Hacker's Delight, based on the square root algorithm.
+template <typename B, typename I, unsigned int F, bool R>
+fpm::fixed<B, I, F, R> reference_cbrt(fpm::fixed<B, I, F, R> x)
+{
+    // We start at the greatest power of eight that's less than the argument.
+    int ofs = ((fpm::detail::find_highest_bit(x.raw_value()) + 2*F) / 3 * 3);
+    I num = I{x.raw_value()};
+    I res = 0;
+
+    const auto do_round = [&]
+    {
+        for (; ofs >= 0; ofs -= 3)
+        {
+            res += res;
+            const I val = (3*res*(res + 1) + 1) << ofs;
+            if (num >= val)
+            {
+                num -= val;
+                res++;
+            }
+        }
+    };
+
+    // We should shift by 2*F (since there are two multiplications), but that
+    // could overflow even the intermediate type, so we have to split the
+    // algorithm up in two rounds of F bits each. Each round will deplete
+    // 'num' digit by digit, so after a round we can shift it again.
+    num <<= F;
+    ofs -= F;
+    do_round();
+
+    num <<= F;
+    ofs += F;
+    do_round();
+
+    return fpm::fixed<B, I, F, R>::from_raw_value(static_cast<B>(res));
+}
+
+// Verifies that fpm::cbrt is exact when not rounding, and at most one unit above the
+// reference when rounding.
+template <typename B, typename I, unsigned int F, bool R>
+void test_cbrt_exact(fpm::fixed<B, I, F, R> x)
+{
+    if (x.raw_value() == 0)
+    {
+        EXPECT_EQ(x, cbrt(x));
+        return;
+    }
+
+    const auto expected = reference_cbrt(x).raw_value();
+    const auto actual = cbrt(x).raw_value();
+    if (!R)
+    {
+        EXPECT_EQ(expected, actual) << "raw value " << x.raw_value();
+    }
+    else
+    {
+        EXPECT_LE(expected, actual) << "raw value " << x.raw_value();
+        EXPECT_GE(expected + 1, actual) << "raw value " << x.raw_value();
+    }
+}
+
+template <typename P>
+void test_cbrt_exact()
+{
+    using B = decltype(P().raw_value());
+
+    // Every power of two, and its neighbours
+    for (int shift = 0; shift < std::numeric_limits<B>::digits; ++shift)
+    {
+        for (B offset = -1; offset <= 1; ++offset)
+        {
+            test_cbrt_exact(P::from_raw_value((B{1} << shift) + offset));
+        }
+    }
+
+    // Perfect cubes are exact, regardless of rounding
+    for (std::int64_t i = 1; static_cast<double>(i) * i * i < static_cast<double>(std::numeric_limits<P>::max()); ++i)
+    {
+        EXPECT_EQ(P(i), cbrt(P(i * i * i)));
+        EXPECT_EQ(P(-i), cbrt(P(-i * i * i)));
+    }
+
+    // An irregular sweep over the entire positive range, with the same number of steps for every BaseType
+    const B step = (B{104729} << (std::numeric_limits<B>::digits - 31)) | 1;
+    for (B raw = 0; raw >= 0 && raw < std::numeric_limits<B>::max() - step; raw += step)
+    {
+        test_cbrt_exact(P::from_raw_value(raw));
+    }
+
+    test_cbrt_exact(std::numeric_limits<P>::max());
+}
+}
+
+TEST(power, cbrt_exact)
+{
+    // Verify fpm::cbrt against the digit-by-digit reference for various formats
+    test_cbrt_exact<fpm::fixed<std::int32_t, std::int64_t, 8, false>>();
+    test_cbrt_exact<fpm::fixed<std::int32_t, std::int64_t, 16, false>>();
+    test_cbrt_exact<fpm::fixed<std::int32_t, std::int64_t, 24, false>>();
+    test_cbrt_exact<fpm::fixed_24_8>();
+    test_cbrt_exact<fpm::fixed_16_16>();
+    test_cbrt_exact<fpm::fixed_8_24>();
+#if defined(__SIZEOF_INT128__)
+    // BaseTypes wider than 32 bits
+    test_cbrt_exact<fpm::fixed<std::int64_t, __int128, 24, false>>();
+    test_cbrt_exact<fpm::fixed<std::int64_t, __int128, 32, false>>();
+    EXPECT_EQ((fpm::fixed<std::int64_t, __int128, 24>(1000)), cbrt(fpm::fixed<std::int64_t, __int128, 24>(1e9)));
+#endif
+}
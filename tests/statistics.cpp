@@ -0,0 +1,107 @@
+#include "common.hpp"
+#include <fpm/math.hpp>
+
+namespace
+{
+    double normal_cdf_real(double x)
+    {
+        return std::erfc(-x / std::sqrt(2.0)) / 2;
+    }
+
+    // Inverts the normal CDF by bisection, which is slow but does not lose precision in the tails
+    double probit_real(double p)
+    {
+        double lo = -40, hi = 40;
+        for (int i = 0; i < 200; ++i)
+        {
+            const double mid = (lo + hi) / 2;
+            (normal_cdf_real(mid) < p ? lo : hi) = mid;
+        }
+        return (lo + hi) / 2;
+    }
+}
+
+TEST(statistics, erf)
+{
+    // For several values and formats, verify that fpm::erf and fpm::erfc are close to their std counterparts.
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    // Step by PI/1000 to get an irregular pattern
+    for (double value = -6; value <= 6; value += 0.003141593)
+    {
+        const auto x16 = P16(value);
+        EXPECT_NEAR(std::erf(static_cast<double>(x16)), static_cast<double>(erf(x16)), ULP16);
+        EXPECT_NEAR(std::erfc(static_cast<double>(x16)), static_cast<double>(erfc(x16)), ULP16);
+
+        const auto x24 = P24(value);
+        EXPECT_NEAR(std::erf(static_cast<double>(x24)), static_cast<double>(erf(x24)), ULP24);
+        EXPECT_NEAR(std::erfc(static_cast<double>(x24)), static_cast<double>(erfc(x24)), ULP24);
+    }
+
+    EXPECT_EQ(P16(0), erf(P16(0)));
+    EXPECT_EQ(P16(1), erfc(P16(0)));
+    EXPECT_EQ(-erf(P16(0.75)), erf(P16(-0.75)));
+    EXPECT_EQ(P16(1), erf(std::numeric_limits<P16>::max()));
+    EXPECT_EQ(P16(-1), erf(std::numeric_limits<P16>::min()));
+    EXPECT_EQ(P16(0), erfc(std::numeric_limits<P16>::max()));
+    EXPECT_EQ(P16(2), erfc(std::numeric_limits<P16>::min()));
+}
+
+TEST(statistics, normal_cdf)
+{
+    // For several values and formats, verify that fpm::normal_cdf is close to the real CDF.
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    // Step by PI/1000 to get an irregular pattern
+    for (double value = -8; value <= 8; value += 0.003141593)
+    {
+        const auto x16 = P16(value);
+        EXPECT_NEAR(normal_cdf_real(static_cast<double>(x16)), static_cast<double>(normal_cdf(x16)), ULP16);
+
+        const auto x24 = P24(value);
+        EXPECT_NEAR(normal_cdf_real(static_cast<double>(x24)), static_cast<double>(normal_cdf(x24)), ULP24);
+    }
+
+    EXPECT_EQ(P16(0.5), normal_cdf(P16(0)));
+    EXPECT_EQ(P16(1), normal_cdf(std::numeric_limits<P16>::max()));
+    EXPECT_EQ(P16(0), normal_cdf(std::numeric_limits<P16>::min()));
+}
+
+TEST(statistics, probit)
+{
+    // For several values and formats, verify that fpm::probit is close to the real inverse CDF.
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    // Step by PI/10000 to get an irregular pattern
+    for (double value = 0.0001; value < 1; value += 0.0003141593)
+    {
+        const auto p16 = P16(value);
+        EXPECT_NEAR(probit_real(static_cast<double>(p16)), static_cast<double>(probit(p16)), ULP16);
+
+        const auto p24 = P24(value);
+        EXPECT_NEAR(probit_real(static_cast<double>(p24)), static_cast<double>(probit(p24)), ULP24);
+    }
+
+    // The extreme tails
+    for (int i = 1; i < 256; ++i)
+    {
+        const auto p16 = P16::from_raw_value(i);
+        EXPECT_NEAR(probit_real(static_cast<double>(p16)), static_cast<double>(probit(p16)), ULP16);
+
+        const auto p24 = P24::from_raw_value(i);
+        EXPECT_NEAR(probit_real(static_cast<double>(p24)), static_cast<double>(probit(p24)), ULP24);
+    }
+
+    EXPECT_EQ(P16(0), probit(P16(0.5)));
+    EXPECT_EQ(-probit(P16(0.1)), probit(P16(0.9)));
+    EXPECT_EQ(-probit(P16::from_raw_value(1)), probit(P16::from_raw_value(65535)));
+}
@@ -88,6 +88,115 @@ TEST(trigonometry, tan)
 #endif
 }
 
+#if defined(__SIZEOF_INT128__)
+TEST(trigonometry, sin_cos_tan_wide)
+{
+    // Wider BaseTypes reduce the argument and evaluate a polynomial in the fixed-point type
+    using P = fpm::fixed<std::int64_t, __int128, 32>;
+    const double PI = std::acos(-1);
+
+    constexpr auto MAX_ERROR = 0.001;
+
+    for (int angle = -3599; angle <= 3600; angle += 3)
+    {
+        const auto x = P(angle * PI / 180);
+        const auto flt_x = static_cast<double>(x);
+        EXPECT_NEAR(std::sin(flt_x), static_cast<double>(sin(x)), MAX_ERROR);
+        EXPECT_NEAR(std::cos(flt_x), static_cast<double>(cos(x)), MAX_ERROR);
+        if (std::abs(std::cos(flt_x)) > 0.1)
+        {
+            EXPECT_NEAR(std::tan(flt_x), static_cast<double>(tan(x)), MAX_ERROR / (std::cos(flt_x) * std::cos(flt_x)));
+        }
+    }
+}
+#endif
+
+TEST(trigonometry, reduction_precision)
+{
+    // For large arguments and few fraction bits, verify that the reduced sin, cos and tan are within 1 ULP.
+    using P8 = fpm::fixed_24_8;
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const auto ULP8 = static_cast<double>(std::numeric_limits<P8>::epsilon());
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    // Step by an irregular raw value through the whole range of each type
+    for (std::int64_t raw = INT32_MIN; raw <= INT32_MAX; raw += 6700417)
+    {
+        const auto x8 = P8::from_raw_value(static_cast<std::int32_t>(raw));
+        const auto x16 = P16::from_raw_value(static_cast<std::int32_t>(raw));
+        const auto x24 = P24::from_raw_value(static_cast<std::int32_t>(raw));
+        EXPECT_NEAR(std::sin(static_cast<double>(x8)), static_cast<double>(sin(x8)), ULP8);
+        EXPECT_NEAR(std::cos(static_cast<double>(x8)), static_cast<double>(cos(x8)), ULP8);
+        EXPECT_NEAR(std::sin(static_cast<double>(x16)), static_cast<double>(sin(x16)), ULP16);
+        EXPECT_NEAR(std::cos(static_cast<double>(x16)), static_cast<double>(cos(x16)), ULP16);
+        EXPECT_NEAR(std::sin(static_cast<double>(x24)), static_cast<double>(sin(x24)), ULP24);
+        EXPECT_NEAR(std::cos(static_cast<double>(x24)), static_cast<double>(cos(x24)), ULP24);
+
+        // Away from its poles, the tangent is accurate as well
+        if (std::abs(std::cos(static_cast<double>(x8))) > 0.1)
+        {
+            EXPECT_NEAR(std::tan(static_cast<double>(x8)), static_cast<double>(tan(x8)), ULP8);
+        }
+        if (std::abs(std::cos(static_cast<double>(x16))) > 0.1)
+        {
+            EXPECT_NEAR(std::tan(static_cast<double>(x16)), static_cast<double>(tan(x16)), ULP16);
+        }
+    }
+
+    EXPECT_EQ(P16(0), sin(P16(0)));
+    EXPECT_EQ(P16(1), cos(P16(0)));
+    EXPECT_EQ(P16(0), tan(P16(0)));
+
+    // The tag that used to select this reduction is still accepted
+    EXPECT_EQ(sin(P16(1000.5)), sin(P16(1000.5), fpm::precise_reduction));
+    EXPECT_EQ(cos(P16(1000.5)), cos(P16(1000.5), fpm::precise_reduction));
+    EXPECT_EQ(tan(P16(1000.5)), tan(P16(1000.5), fpm::precise_reduction));
+    EXPECT_EQ(-sin(P16(1000)), sin(P16(-1000)));
+}
+
+TEST(trigonometry, inverse_precision)
+{
+    // The inverse functions are computed as Q.30, so verify that they are within 1 ULP for several formats.
+    using P8 = fpm::fixed_24_8;
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const auto ULP8 = static_cast<double>(std::numeric_limits<P8>::epsilon());
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    for (double value = -1; value <= 1; value += 0.00031415)
+    {
+        const auto x8 = P8(value);
+        const auto x16 = P16(value);
+        const auto x24 = P24(value);
+        EXPECT_NEAR(std::asin(static_cast<double>(x8)), static_cast<double>(asin(x8)), ULP8);
+        EXPECT_NEAR(std::acos(static_cast<double>(x8)), static_cast<double>(acos(x8)), ULP8);
+        EXPECT_NEAR(std::asin(static_cast<double>(x16)), static_cast<double>(asin(x16)), ULP16);
+        EXPECT_NEAR(std::acos(static_cast<double>(x16)), static_cast<double>(acos(x16)), ULP16);
+        EXPECT_NEAR(std::asin(static_cast<double>(x24)), static_cast<double>(asin(x24)), ULP24);
+        EXPECT_NEAR(std::acos(static_cast<double>(x24)), static_cast<double>(acos(x24)), ULP24);
+        EXPECT_NEAR(std::atan(static_cast<double>(x24)), static_cast<double>(atan(x24)), ULP24);
+    }
+
+    // Step by an irregular raw value through the whole range of each type
+    for (std::int64_t raw = INT32_MIN; raw <= INT32_MAX; raw += 6700417)
+    {
+        const auto x8 = P8::from_raw_value(static_cast<std::int32_t>(raw));
+        const auto x16 = P16::from_raw_value(static_cast<std::int32_t>(raw));
+        EXPECT_NEAR(std::atan(static_cast<double>(x8)), static_cast<double>(atan(x8)), ULP8);
+        EXPECT_NEAR(std::atan(static_cast<double>(x16)), static_cast<double>(atan(x16)), ULP16);
+    }
+
+    EXPECT_EQ(P16(0), asin(P16(0)));
+    EXPECT_EQ(P16::half_pi(), asin(P16(1)));
+    EXPECT_EQ(-P16::half_pi(), asin(P16(-1)));
+    EXPECT_EQ(P16(0), acos(P16(1)));
+    EXPECT_EQ(P16::pi(), acos(P16(-1)));
+    EXPECT_EQ(P16(0), atan(P16(0)));
+}
+
 TEST(trigonometry, atan)
 {
     using P = fpm::fixed<std::int32_t, std::int64_t, 12>;
@@ -141,6 +250,24 @@ TEST(trigonometry, acos)
     }
 }
 
+#if defined(__SIZEOF_INT128__)
+TEST(trigonometry, inverse_wide)
+{
+    // Wider BaseTypes calculate the inverse functions with the fixed-point type
+    using P = fpm::fixed<std::int64_t, __int128, 24>;
+
+    constexpr auto MAX_ERROR_PERC = 0.025;
+
+    for (int x = -1000; x <= 1000; ++x)
+    {
+        const auto value = x / 1000.0;
+        EXPECT_TRUE(HasMaximumError(static_cast<double>(asin(P(value))), std::asin(value), MAX_ERROR_PERC));
+        EXPECT_TRUE(HasMaximumError(static_cast<double>(acos(P(value))), std::acos(value), MAX_ERROR_PERC));
+        EXPECT_TRUE(HasMaximumError(static_cast<double>(atan(P(value * 1e6))), std::atan(value * 1e6), MAX_ERROR_PERC));
+    }
+}
+#endif
+
 TEST(trigonometry, atan2)
 {
     using P = fpm::fixed<std::int32_t, std::int64_t, 12>;
@@ -163,6 +290,47 @@ TEST(trigonometry, atan2)
 #endif
 }
 
+TEST(trigonometry, atan2_precision)
+{
+    // For points on circles of several radii, verify that fpm::atan2 is within one unit in
+    // the last place of std::atan2, for several formats.
+    using P16 = fpm::fixed_16_16;
+    using P24 = fpm::fixed_8_24;
+    const double PI = std::acos(-1);
+    const auto ULP16 = static_cast<double>(std::numeric_limits<P16>::epsilon());
+    const auto ULP24 = static_cast<double>(std::numeric_limits<P24>::epsilon());
+
+    for (double radius : { 0.001, 0.3, 1.0, 100.0 })
+    {
+        for (int angle = -1799; angle <= 1800; ++angle)
+        {
+            const auto y16 = P16(radius * std::sin(angle * PI / 1800));
+            const auto x16 = P16(radius * std::cos(angle * PI / 1800));
+            if (x16 != P16(0) || y16 != P16(0))
+            {
+                const auto atan2_real = std::atan2(static_cast<double>(y16), static_cast<double>(x16));
+                EXPECT_NEAR(atan2_real, static_cast<double>(atan2(y16, x16)), ULP16);
+            }
+
+            const auto y24 = P24(std::min(radius, 100.0) / 100 * std::sin(angle * PI / 1800));
+            const auto x24 = P24(std::min(radius, 100.0) / 100 * std::cos(angle * PI / 1800));
+            if (x24 != P24(0) || y24 != P24(0))
+            {
+                const auto atan2_real = std::atan2(static_cast<double>(y24), static_cast<double>(x24));
+                EXPECT_NEAR(atan2_real, static_cast<double>(atan2(y24, x24)), ULP24);
+            }
+        }
+    }
+
+    // The axes and diagonals are exact to the last place
+    EXPECT_EQ(P16(0), atan2(P16(0), P16(5)));
+    EXPECT_EQ(P16::pi(), atan2(P16(0), P16(-5)));
+    EXPECT_EQ(P16::half_pi(), atan2(P16(5), P16(0)));
+    EXPECT_EQ(-P16::half_pi(), atan2(P16(-5), P16(0)));
+    EXPECT_EQ(P16(PI / 4), atan2(P16(3), P16(3)));
+    EXPECT_EQ(-atan2(P16(2), P16(-7)), atan2(P16(-2), P16(-7)));
+}
+
 // Naively, atan2(y, x) does y / x which would overflow for near-zero x with Q16.16.
 // Test that we've got protections in place for this.
 TEST(trigonometry, atan2_near_zero)
@@ -187,3 +355,26 @@ TEST(trigonometry, atan2_near_zero)
         EXPECT_TRUE(HasMaximumError(atan2_fixed, atan2_real, MAX_ERROR_PERC));
     }
 }
+
+#if defined(__SIZEOF_INT128__)
+TEST(trigonometry, atan2_wide)
+{
+    // Wider BaseTypes calculate atan2 with the fixed-point type, at the accuracy of its polynomial
+    using P = fpm::fixed<std::int64_t, __int128, 24>;
+    const double PI = std::acos(-1);
+
+    constexpr auto MAX_ERROR_PERC = 0.025;
+
+    for (double radius : { 0.5, 1000.0, 3e8 })
+    {
+        for (int angle = -1799; angle <= 1800; angle += 7)
+        {
+            const auto y = P(radius * std::sin(angle * PI / 1800));
+            const auto x = P(radius * std::cos(angle * PI / 1800));
+            const auto atan2_real = std::atan2(static_cast<double>(y), static_cast<double>(x));
+            EXPECT_TRUE(HasMaximumError(static_cast<double>(atan2(y, x)), atan2_real, MAX_ERROR_PERC));
+        }
+    }
+    EXPECT_TRUE(HasMaximumError(static_cast<double>(atan2(P(1e8), P(3e8))), std::atan2(1e8, 3e8), MAX_ERROR_PERC));
+}
+#endif